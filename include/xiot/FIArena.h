@@ -0,0 +1,84 @@
+/*=========================================================================
+     This file is part of the XIOT library.
+
+     Copyright (C) 2008-2009 EDF R&D
+     Author: Kristian Sons (xiot@actor3d.com)
+
+     This library is free software; you can redistribute it and/or modify
+     it under the terms of the GNU Lesser Public License as published by
+     the Free Software Foundation; either version 2.1 of the License, or
+     (at your option) any later version.
+
+     The XIOT library is distributed in the hope that it will be useful,
+     but WITHOUT ANY WARRANTY; without even the implied warranty of
+     MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+     GNU Lesser Public License for more details.
+
+     You should have received a copy of the GNU Lesser Public License
+     along with XIOT; if not, write to the Free Software
+     Foundation, Inc., 51 Franklin St, Fifth Floor, Boston,
+     MA 02110-1301  USA
+=========================================================================*/
+#ifndef FI_ARENA_H
+#define FI_ARENA_H
+
+#include <cstddef>
+#include <vector>
+#include <xiot/FIConfig.h>
+
+namespace FI {
+
+/**
+ * Simple bump allocator for the transient data of the decoder.
+ *
+ * Memory is handed out from large blocks and released all at once
+ * by reset(). The blocks are kept for reuse, so after the first few
+ * elements decoding does not need to allocate from the heap anymore.
+ *
+ * @see SAXParser
+ */
+class OPENFI_EXPORT Arena {
+  public:
+    /// Default size of the blocks allocated from the heap (64 KiB).
+    static const size_t DEFAULT_BLOCK_SIZE = 64 * 1024;
+
+    /// Constructor.
+    Arena(size_t blockSize = DEFAULT_BLOCK_SIZE);
+    /// Destructor.
+    ~Arena();
+
+    /**
+   * Returns size bytes of memory, valid until the next reset().
+   */
+    void *allocate(size_t size);
+
+    /**
+   * Releases all memory handed out since the last reset. Blocks of
+   * the default size are kept, larger blocks are freed.
+   */
+    void reset();
+
+    /// Returns the number of allocate() calls served.
+    size_t getAllocationCount() const { return _allocationCount; };
+
+    /// Returns the number of blocks allocated from the heap.
+    size_t getHeapAllocationCount() const { return _heapAllocationCount; };
+
+  private:
+    Arena(const Arena &);
+    Arena &operator=(const Arena &);
+
+    size_t _blockSize;
+    std::vector<unsigned char *> _blocks;
+    std::vector<unsigned char *> _largeBlocks;
+    size_t _current;
+    unsigned char *_pos;
+    unsigned char *_end;
+
+    size_t _allocationCount;
+    size_t _heapAllocationCount;
+};
+
+}  // namespace FI
+
+#endif
@@ -39,6 +39,8 @@ class ParserVocabulary;
  */
 class OPENFI_EXPORT ContentHandler {
   public:
+    virtual ~ContentHandler(){};
+
     virtual void startDocument() = 0;
 
     virtual void endDocument() = 0;
@@ -47,6 +49,21 @@ class OPENFI_EXPORT ContentHandler {
     virtual void endElement(const ParserVocabulary *vocab, const Element &element) = 0;
 
     virtual void characters(const ParserVocabulary *vocab, const CharacterChunk &chunk) = 0;
+
+    /**
+   * Called by the SAXParser for each attribute of an element before its
+   * value is decoded. If false is returned, the value is skipped and the
+   * attribute is not passed to startElement().
+   */
+    virtual bool isAttributeOfInterest(const ParserVocabulary *, const Element &, const QualifiedNameOrIndex &) { return true; };
+
+    /**
+   * Called for an attribute that is not of interest if its value is a
+   * literal encoded with an encoding algorithm. If true is returned, the
+   * value is decoded and passed to startElement() anyway, e.g. because the
+   * algorithm of another value depends on it.
+   */
+    virtual bool isEncodedAttributeOfInterest(const ParserVocabulary *, const Element &, const QualifiedNameOrIndex &, int) { return false; };
 };
 
 /**
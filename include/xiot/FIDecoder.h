@@ -22,14 +22,19 @@
 #ifndef FI_DECODER_H
 #define FI_DECODER_H
 
+#include <cassert>
 #include <fstream>
 #include <string>
+#include <xiot/FIArena.h>
+#include <xiot/FIInputSource.h>
 #include <xiot/FIParserVocabulary.h>
 #include <xiot/FITypes.h>
 #include <xiot/X3DFIAttributes.h>
 
 namespace FI {
 
+struct PrefixEntry;
+
 /**  
  *  Decoder for FI files. 
  *
@@ -39,9 +44,10 @@ namespace FI {
  *  of the standard is found.
  *
  *  Normally a client will not use the Decoder directly but one of
- *  it`s derived classes, i.e. the until now only derived class FI::SAXParser.
+ *  it`s derived classes, FI::SAXParser or FI::PushParser.
  *  
  *  @see SAXParser
+ *  @see PushParser
  */
 class OPENFI_EXPORT Decoder {
   public:
@@ -50,8 +56,18 @@ class OPENFI_EXPORT Decoder {
     /// Destructor.
     virtual ~Decoder();
 
+    /**
+   * Sets the stream to decode. The stream is read in large blocks
+   * using a BufferedInputSource.
+   */
     void setStream(std::istream *stream);
 
+    /**
+   * Sets the source to decode. The source is not owned by the decoder
+   * and has to stay valid while decoding.
+   */
+    void setInputSource(InputSource *source);
+
     /**
    *  C.1 Fast infoset document.
    *  This method validates the header of a Fast Infoset document
@@ -73,6 +89,8 @@ class OPENFI_EXPORT Decoder {
    * C.4 Encoding of the Attribute type
    */
     void getAttribute(FI::Attribute &value);
+    /// Decodes the value of an attribute whose name is decoded, its first octet is in _b.
+    void getAttributeValue(FI::Attribute &value);
 
     /**
    * C.7 Encoding of the CharacterChunk type
@@ -122,12 +140,12 @@ class OPENFI_EXPORT Decoder {
     /**
    * C.23 Encoding of the NonEmptyOctetString starting on the fifth bit of an octet
    */
-    void getNonEmptyOctetString5(FI::NonEmptyOctetString &value);
+    void getNonEmptyOctetString5(FI::OctetString &value);
 
     /**
    * C.24 Encoding of the NonEmptyOctetString type starting on the seventh bit of an octet
    */
-    void getNonEmptyOctetString7(FI::NonEmptyOctetString &value);
+    void getNonEmptyOctetString7(FI::OctetString &value);
 
     /**
    * C.25 Encoding of integers in the range 1 to 2^20 starting on the second bit of an octet
@@ -181,17 +199,87 @@ class OPENFI_EXPORT Decoder {
 
     void decodeExternalVocabularyURI();
 
+    /**
+   * Adds the value of an attribute or a character chunk with add-to-table set
+   * to the vocabulary (C.14.3.1, C.15.3.1). Derived parsers can defer this
+   * until the surrounding item is completely decoded.
+   */
+    virtual void addAttributeValue(const FI::NonIdentifyingStringOrIndex &value);
+    virtual void addCharacterChunk(const FI::NonIdentifyingStringOrIndex &value);
+
     bool readChildren();                        // C.2
     bool readAttributes(FI::Element &element);  // C.4
 
-    int checkBit(unsigned char c, unsigned char iPos);
+    /// Returns the bit at position iPos (1 - 8, counted from the most significant bit) of c
+    inline int checkBit(unsigned char c, unsigned char iPos) {
+        assert(iPos >= 1 && iPos <= 8);
+        return c & (0x80 >> (iPos - 1));
+    }
+
+    /**
+   * Returns the next octet of the input. Reading beyond the end of
+   * the input returns the double terminator 0xFF.
+   */
+    inline unsigned char getOctet() {
+        if (_pos == _end && !fillWindow())
+            return 0xFF;
+        return *_pos++;
+    };
+
+    /**
+   * Copies the next length octets of the input to dest.
+   * Throws if the input ends before.
+   */
+    void getOctets(unsigned char *dest, size_t length);
+
+    /**
+   * Reads the next length octets into value. If the input source is
+   * contiguous, value becomes a view into the input instead of a copy.
+   * Otherwise the octets are copied to the arena, if one is set.
+   */
+    void getOctetString(FI::OctetString &value, size_t length);
+
+    /**
+   * Advances over the next length octets without reading them, seeking
+   * the input source if possible. Throws if the input ends before.
+   */
+    void skipOctets(size_t length);
+
+    /**
+   * Decodes an attribute or a character chunk whose value is not needed.
+   * Literal values are skipped by their length without being copied,
+   * unless add-to-table is set and they have to be added to the vocabulary.
+   */
+    void skipAttribute();
+    void skipAttributeValue();
+    void skipCharacterChunk();
+    /// Skips the octets of C.23, with the length in _b
+    void skipNonEmptyOctetString5();
+
+    /// Reads a 32 bit unsigned integer in big-endian byte order.
+    unsigned int getUInt32();
+
+    /// Returns true, if all octets of the input have been read.
+    bool isEndOfInput();
+
+  private:
+    bool fillWindow();
+    unsigned int getPrefixedValue(const PrefixEntry &entry);
 
   protected:
     unsigned char _b;
     ParserVocabulary *_vocab;
 
     std::map<std::string, ParserVocabulary *> _externalVocabularies;
-    std::istream *_stream;
+    InputSource *_source;
+    BufferedInputSource *_streamSource;
+
+    /// Optional allocator for transient octet strings, owned by derived classes
+    Arena *_arena;
+
+    /// Window of the current input block not yet decoded
+    const unsigned char *_pos;
+    const unsigned char *_end;
 };
 
 }  // namespace FI
@@ -23,11 +23,55 @@
 #define FI_FIENCODER_H
 
 #include <cassert>
+#include <deque>
 #include <ostream>
+#include <string>
+#include <vector>
 #include <xiot/FITypes.h>
 
 namespace FI {
 
+/**
+ * Statistics of the attribute value table of a FIEncoder.
+ */
+struct OPENFI_EXPORT StringTableStatistics {
+    StringTableStatistics() : entries(0), octets(0), indexed(0), literals(0){};
+
+    /// The number of values added to the table
+    size_t entries;
+    /// The size of the added values in octets
+    size_t octets;
+    /// The number of values encoded as index
+    size_t indexed;
+    /// The number of values encoded as literal
+    size_t literals;
+};
+
+/**
+ * Hash index of the strings an encoder added to a vocabulary table. Like
+ * in the tables of the decoder, the index of the first string is 1.
+ */
+class OPENFI_EXPORT StringTable {
+  public:
+    StringTable();
+
+    /// Returns the index of the value, 0 if it is not in the table
+    unsigned int find(const std::string &value) const;
+    /// Adds the value, it has to be new
+    void add(const std::string &value);
+    void clear();
+
+    size_t size() const { return _values.size(); };
+
+  private:
+    void rehash(size_t slots);
+
+    // A deque does not move the values when it grows
+    std::deque<std::string> _values;
+    // Open addressing with linear probing, the slots hold index + 1
+    std::vector<unsigned int> _slots;
+};
+
 /**  
  *  Decoder for FI files. 
  */
@@ -39,8 +83,9 @@ class OPENFI_EXPORT FIEncoder {
     // Resets stream and positions
     void reset();
 
-    // Set the stream for output
-    void setStream(std::ostream &stream);
+    // Set the stream for output. With seekOnReset, reset() returns to the
+    // start of the stream, otherwise the next document is appended
+    void setStream(std::ostream &stream, bool seekOnReset = false);
 
     void encodeHeader(bool encodeXmlDecl);
     void encodeInitialVocabulary();
@@ -50,8 +95,16 @@ class OPENFI_EXPORT FIEncoder {
     void encodeLineFeed();
 
     // ITU C.14 Encoding of the NonIdentifyingStringOrIndex
-    // type starting on the first bit of an octet
-    //void encodeNonIdentifyingStringOnFirstBit();
+    // type starting on the first bit of an octet. A value of the
+    // attribute value table is encoded as its index. Other values are
+    // added to the table if addToTable is true and the table is not full
+    void encodeNonIdentifyingStringOrIndex1(const std::string &value, bool addToTable);
+
+    // The maximum size of the attribute value table in octets, 0 (the
+    // default) switches the table off
+    void setAttributeValueTableLimit(size_t octets);
+    size_t getAttributeValueTableLimit() const;
+    const StringTableStatistics &getAttributeValueTableStatistics() const;
 
     // ITU C.19 Encoding of the EncodedCharacterString type starting
     // on the third bit of an octet
@@ -75,57 +128,49 @@ class OPENFI_EXPORT FIEncoder {
 
     virtual void encodeAttributeIntegerArray(const int *values, size_t size);
     virtual void encodeAttributeFloatArray(const float *values, size_t size);
+    void encodeAttributeBooleanArray(const std::vector<bool> &values);
 
-    // Puts a bitstring to the current byte bit by bit
+    // Puts a bitstring like "1111" to the stream. The encoder uses
+    // putBits(value, count) for its constant patterns
     void putBits(const std::string &bitstring) {
         for (std::string::const_iterator I = bitstring.begin(); I != bitstring.end(); I++)
-            putBit((*I) == '1');
+            putBits((*I) == '1' ? 1 : 0, 1);
     }
 
-    // Puts the integer value to the stream using count bits
-    // for encoding
-    void putBits(unsigned int value, unsigned char count) {
-        // Can be optimized
-        while (count > 0) {
-            count = this->append(value, count);
+    // Puts the lowest count bits of value to the stream, most
+    // significant bit first. count must not be larger than 32
+    inline void putBits(unsigned int value, unsigned int count) {
+        assert(count <= 32);
+        if (count < 32)
+            value &= (1u << count) - 1;
+        // Less than 32 bits are pending, so the 64 bits never overflow
+        _bits = (_bits << count) | value;
+        _bitCount += count;
+        if (_bitCount >= 32) {
+            _bitCount -= 32;
+            putWord(static_cast<unsigned int>(_bits >> _bitCount));
         }
     }
 
-
     // Puts on bit to the current byte true = 1, false = 0
-    inline void putBit(bool on) {
-        assert(_currentBytePos < 8);
-        if (on) {
-            unsigned char pos = _currentBytePos;
-            unsigned char mask = (unsigned char)(0x80 >> pos);
-            _currentByte |= mask;
-        }
-        _currentBytePos++;
-        tryFlush();
-    }
+    inline void putBit(bool on) { putBits(on ? 1 : 0, 1); }
 
     // Puts whole bytes to the file stream. CurrentBytePos must
     // be 0 for this
-    void putBytes(const unsigned char *bytes, size_t length) {
-        if (_currentBytePos == 0)
-            _stream->write(reinterpret_cast<const char *>(bytes), length);
-        else {
-            assert(false);
-            throw std::runtime_error("Wrong position in FiEncode::PutBytes");
-        }
-    }
+    void putBytes(const unsigned char *bytes, size_t length);
 
     // Fills up the current byte with 0 values
-    inline void fillByte() {
-        while (_currentBytePos)
-            putBit(0);
-    };
+    inline void fillByte() { putBits(0, (8 - _bitCount % 8) % 8); };
+
+    // Writes the buffered bytes to the stream. Has to be called before
+    // the stream is closed, the bits of an incomplete byte are kept
+    void flush();
 
   protected:
     inline void encodeEncodingAlgorithmStart(int algorithmID) {
         // ITU C.19.3.4: If the alternative encoding-algorithm is present,
         // then the two bits '11' (discriminant) are appended
-        putBits("11");
+        putBits(0x3, 2);
         //C.29.2 The value, minus the lower bound of the range, is encoded as an unsigned integer in a field of eight bits and
         //appended to the bit stream.
         putBits(algorithmID - 1, 8);
@@ -135,39 +180,42 @@ class OPENFI_EXPORT FIEncoder {
         putBytes(&value.front(), value.size());
     }
 
-    inline unsigned char append(unsigned int value, unsigned char count) {
-        assert(_currentBytePos < 8);
-        while ((_currentBytePos < 8) && count > 0) {
-            // Value and der Stelle i
-            unsigned int mask = 1;
-            bool isSet = !(((mask << (count - 1)) & value) == 0);
-            if (isSet) {
-                _currentByte |= static_cast<unsigned char>(0x80 >> _currentBytePos);
-            }
-            _currentBytePos++;
-            count--;
-        }
-        tryFlush();
-        return count;
-    }
-
+    // The bit position in the current byte. Range: 0-7
+    inline unsigned int getCurrentBytePos() const { return _bitCount % 8; }
 
-    // This is the current byte to fill
-    unsigned char _currentByte;
-    // This is the current byte position. Range: 0-7
-    unsigned char _currentBytePos;
     bool _firstLineFeed;
+    // The values of the initial vocabulary, added again on reset()
+    std::vector<std::string> _initialAttributeValues;
 
   private:
-    inline void tryFlush() {
-        assert(_stream);
-        if (_currentBytePos == 8) {
-            _stream->put(_currentByte);
-            _currentByte = 0;
-            _currentBytePos = 0;
-        }
+    // Appends 32 bits to the buffer in network byte order
+    inline void putWord(unsigned int word) {
+        if (_bufferPos + 4 > _buffer.size())
+            flushBuffer();
+        unsigned char *p = &_buffer[_bufferPos];
+        p[0] = static_cast<unsigned char>(word >> 24);
+        p[1] = static_cast<unsigned char>(word >> 16);
+        p[2] = static_cast<unsigned char>(word >> 8);
+        p[3] = static_cast<unsigned char>(word);
+        _bufferPos += 4;
     }
+
+    // Moves the complete bytes of the pending bits to the buffer
+    void putPendingBytes();
+    void flushBuffer();
+
+    // The pending bits are the lowest _bitCount bits, always less than 32
+    unsigned long long _bits;
+    unsigned int _bitCount;
+    // The output is collected and written to the stream in large blocks
+    std::vector<unsigned char> _buffer;
+    size_t _bufferPos;
     std::ostream *_stream;
+    bool _seekOnReset;
+
+    StringTable _attributeValues;
+    size_t _attributeValueTableLimit;
+    StringTableStatistics _attributeValueStatistics;
 };
 
 }  // namespace FI
@@ -39,7 +39,7 @@ class OPENFI_EXPORT IEncodingAlgorithm {
 		* @octets The byte array containing the encoded data
 		* @return The string representation of the decoded input
 		*/
-    virtual std::string decodeToString(const NonEmptyOctetString &octets) const = 0;
+    virtual std::string decodeToString(const OctetString &octets) const = 0;
 };
 
 /**
@@ -49,22 +49,27 @@ class OPENFI_EXPORT IntEncodingAlgorithm : public IEncodingAlgorithm {
   public:
     /// This encoding algorithm has a vocabulary table index of 4
     static const int ALGORITHM_ID = 4;
-    virtual std::string decodeToString(const FI::NonEmptyOctetString &octets) const;
-    static void decodeToIntArray(const FI::NonEmptyOctetString &octets, std::vector<int> &vec);
+    virtual std::string decodeToString(const FI::OctetString &octets) const;
+    static void decodeToIntArray(const FI::OctetString &octets, std::vector<int> &vec);
     static void encode(const int *values, size_t size, FI::NonEmptyOctetString &octets);
 };
 
 /**
  * 10.7 The "boolean" encoding algorithm
- * @warning Not implemented yet
+ *
+ * One bit per value, preceded by four bits holding the number of unused
+ * bits in the last octet.
  */
 class OPENFI_EXPORT BooleanEncodingAlgorithm : public IEncodingAlgorithm {
   public:
     /// This encoding algorithm has a vocabulary table index of 6
     static const int ALGORITHM_ID = 6;
 
-    virtual std::string decodeToString(const FI::NonEmptyOctetString &octets) const;
-    static void decodeToBoolArray(const FI::NonEmptyOctetString &octets, std::vector<bool> &vec);
+    virtual std::string decodeToString(const FI::OctetString &octets) const;
+    static void decodeToBoolArray(const FI::OctetString &octets, std::vector<bool> &vec);
+    static void encode(const std::vector<bool> &values, FI::NonEmptyOctetString &octets);
+    /// Returns the number of encoded values
+    static size_t getLength(const FI::OctetString &octets);
 };
 
 /**
@@ -76,8 +81,8 @@ class OPENFI_EXPORT FloatEncodingAlgorithm : public IEncodingAlgorithm {
   public:
     /// This encoding algorithm has a vocabulary table index of 7
     static const int ALGORITHM_ID = 7;
-    virtual std::string decodeToString(const FI::NonEmptyOctetString &octets) const;
-    static void decodeToFloatArray(const FI::NonEmptyOctetString &octets, std::vector<float> &vec);
+    virtual std::string decodeToString(const FI::OctetString &octets) const;
+    static void decodeToFloatArray(const FI::OctetString &octets, std::vector<float> &vec);
     static void encode(const float *values, size_t size, FI::NonEmptyOctetString &octets);
 };
 
@@ -85,7 +90,7 @@ class OPENFI_EXPORT FloatEncodingAlgorithm : public IEncodingAlgorithm {
 /**
  * Some helpers to convert bytes into other datatypes
  */
-class Tools {
+class OPENFI_EXPORT Tools {
   public:
     union float_to_unsigned_int_to_bytes {
         float f;
@@ -115,6 +120,14 @@ class Tools {
         return v.f;
     };
 
+    /**
+     * Reverses the byte order of count 4 byte values from source to dest,
+     * i.e. converts between big-endian octets and host integers or floats.
+     * Source and dest may be unaligned but must not overlap partially.
+     * Uses AVX2 or SSE2 if the CPU supports it.
+     */
+    static void swapBytes4(const unsigned char *source, size_t count, unsigned char *dest);
+
     inline static int reverseBytes(const int *x) {
         /* break x apart, then put it back together backwards */
         int part1 = (*x) & 0xFF;
@@ -0,0 +1,158 @@
+/*=========================================================================
+     This file is part of the XIOT library.
+
+     Copyright (C) 2008-2009 EDF R&D
+     Author: Kristian Sons (xiot@actor3d.com)
+
+     This library is free software; you can redistribute it and/or modify
+     it under the terms of the GNU Lesser Public License as published by
+     the Free Software Foundation; either version 2.1 of the License, or
+     (at your option) any later version.
+
+     The XIOT library is distributed in the hope that it will be useful,
+     but WITHOUT ANY WARRANTY; without even the implied warranty of
+     MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+     GNU Lesser Public License for more details.
+
+     You should have received a copy of the GNU Lesser Public License
+     along with XIOT; if not, write to the Free Software
+     Foundation, Inc., 51 Franklin St, Fifth Floor, Boston,
+     MA 02110-1301  USA
+=========================================================================*/
+#ifndef FI_INPUTSOURCE_H
+#define FI_INPUTSOURCE_H
+
+#include <cstddef>
+#include <istream>
+#include <vector>
+#include <xiot/FIConfig.h>
+
+namespace FI {
+
+/**
+ * Source of the bytes a Decoder reads from.
+ *
+ * Instead of pulling every single octet through a stream, the Decoder asks
+ * the source for the next block of input and decodes directly from that
+ * memory until the block is exhausted.
+ *
+ * @see Decoder::setInputSource()
+ */
+class OPENFI_EXPORT InputSource {
+  public:
+    /// Destructor.
+    virtual ~InputSource(){};
+
+    /**
+   * Provides the next block of input. The block stays valid until the
+   * next call to nextBlock().
+   *
+   * @param begin First byte of the block
+   * @param end One past the last byte of the block
+   * @return false, if the end of the input is reached
+   */
+    virtual bool nextBlock(const unsigned char *&begin, const unsigned char *&end) = 0;
+
+    /**
+   * Returns true, if the source delivers the complete input as one single
+   * block that stays valid as long as the source exists.
+   */
+    virtual bool isContiguous() const { return false; };
+
+    /**
+   * Skips the next length octets after the current block without
+   * delivering them.
+   *
+   * @return The number of octets skipped. The default skips nothing,
+   * the Decoder reads over the remaining octets then.
+   */
+    virtual size_t skip(size_t) { return 0; };
+};
+
+/**
+ * InputSource reading from a memory block owned by the caller.
+ */
+class OPENFI_EXPORT MemoryInputSource : public InputSource {
+  public:
+    /// Constructor.
+    MemoryInputSource(const void *data = NULL, size_t length = 0);
+    /// Destructor.
+    virtual ~MemoryInputSource();
+
+    /**
+   * Sets the memory block to read from and rewinds the source.
+   */
+    void setData(const void *data, size_t length);
+
+    virtual bool nextBlock(const unsigned char *&begin, const unsigned char *&end);
+    virtual bool isContiguous() const { return true; };
+
+    /// Returns the length of the memory block in bytes.
+    size_t getLength() const { return _length; };
+
+  protected:
+    const unsigned char *_data;
+    size_t _length;
+    bool _delivered;
+};
+
+/**
+ * InputSource mapping a complete file into memory. Only regular files
+ * can be mapped, open() will fail for anything else (pipes, devices,
+ * empty files).
+ */
+class OPENFI_EXPORT MemoryMappedInputSource : public MemoryInputSource {
+  public:
+    /// Constructor.
+    MemoryMappedInputSource();
+    /// Destructor.
+    virtual ~MemoryMappedInputSource();
+
+    /**
+   * Maps the given file into memory.
+   * @return false, if the file could not be mapped
+   */
+    bool open(const char *fileName);
+
+    /// Unmaps the file. Called by the destructor.
+    void close();
+
+    /// Returns true, if a file is currently mapped.
+    bool isOpen() const { return _mapping != NULL; };
+
+  private:
+    void *_mapping;
+#ifdef _WIN32
+    void *_fileHandle;
+    void *_mappingHandle;
+#endif
+};
+
+/**
+ * InputSource reading a std::istream in large blocks.
+ */
+class OPENFI_EXPORT BufferedInputSource : public InputSource {
+  public:
+    /// Default size of the blocks read from the stream (1 MiB).
+    static const size_t DEFAULT_BLOCK_SIZE = 1 << 20;
+
+    /// Constructor.
+    BufferedInputSource(std::istream *stream = NULL, size_t blockSize = DEFAULT_BLOCK_SIZE);
+    /// Destructor.
+    virtual ~BufferedInputSource();
+
+    void setStream(std::istream *stream);
+
+    virtual bool nextBlock(const unsigned char *&begin, const unsigned char *&end);
+
+    /// Seeks the stream, if it supports seeking.
+    virtual size_t skip(size_t length);
+
+  private:
+    std::istream *_stream;
+    std::vector<unsigned char> _buffer;
+};
+
+}  // namespace FI
+
+#endif
@@ -106,6 +106,7 @@ class OPENFI_EXPORT DefaultParserVocabulary : public ParserVocabulary {
     AlgorithmTable _encodingAlgorithms;
 
     IntEncodingAlgorithm _intEncodingAlgorithm;
+    BooleanEncodingAlgorithm _booleanEncodingAlgorithm;
     FloatEncodingAlgorithm _floatEncodingAlgorithm;
 
     std::string _externalVocabularyURI;
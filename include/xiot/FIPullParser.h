@@ -0,0 +1,128 @@
+/*=========================================================================
+     This file is part of the XIOT library.
+
+     Copyright (C) 2008-2009 EDF R&D
+     Author: Kristian Sons (xiot@actor3d.com)
+
+     This library is free software; you can redistribute it and/or modify
+     it under the terms of the GNU Lesser Public License as published by
+     the Free Software Foundation; either version 2.1 of the License, or
+     (at your option) any later version.
+
+     The XIOT library is distributed in the hope that it will be useful,
+     but WITHOUT ANY WARRANTY; without even the implied warranty of
+     MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+     GNU Lesser Public License for more details.
+
+     You should have received a copy of the GNU Lesser Public License
+     along with XIOT; if not, write to the Free Software
+     Foundation, Inc., 51 Franklin St, Fifth Floor, Boston,
+     MA 02110-1301  USA
+=========================================================================*/
+#ifndef FI_PULLPARSER_H
+#define FI_PULLPARSER_H
+
+#include <vector>
+#include <xiot/FIArena.h>
+#include <xiot/FIDecoder.h>
+#include <xiot/FITypes.h>
+
+namespace FI {
+
+/**
+ * Parser that decodes a Fast Infoset document one event at a time.
+ *
+ * Instead of passing the events to a ContentHandler, the client asks for
+ * the next event with next() and retrieves its data from the parser.
+ * Only the octets of the next item are read from the input. The open
+ * elements are kept on an explicit stack, so the nesting depth of the
+ * document is not limited by the call stack.
+ *
+ * The element, attributes and character chunk returned for an event are
+ * valid until the next call to next().
+ *
+ * @see SAXParser
+ */
+class OPENFI_EXPORT PullParser : public Decoder {
+  public:
+    /// The events of a document
+    enum EventType {
+        START_DOCUMENT,
+        END_DOCUMENT,
+        START_ELEMENT,
+        END_ELEMENT,
+        CHARACTERS
+    };
+
+    /// Constructor.
+    PullParser();
+    /// Destructor.
+    virtual ~PullParser();
+
+    /**
+   * Decodes the next event. Throws if the input ends before the document
+   * or if it is called again after END_DOCUMENT.
+   */
+    EventType next();
+
+    /// Returns false, if END_DOCUMENT has been returned.
+    bool hasNext() const { return _state != STATE_FINISHED; };
+
+    /// Returns the element of the last START_ELEMENT or END_ELEMENT event.
+    const Element &getElement() const { return _element; };
+
+    /// Returns the attributes of the last START_ELEMENT event.
+    const Attributes &getAttributes() const { return _attributes; };
+
+    /// Returns the character chunk of the last CHARACTERS event.
+    const CharacterChunk &getCharacterChunk() const { return _characterChunk; };
+
+    /// Returns the vocabulary to resolve names and values of the events.
+    const ParserVocabulary *getVocabulary() const { return _vocab; };
+
+    /// Returns the number of open elements.
+    size_t getDepth() const { return _elements.size(); };
+
+    /// @see SAXParser::getArena()
+    const Arena &getArena() const { return _callbackArena; };
+
+  protected:
+    /**
+   * Called after the octets of an item have been decoded and before any
+   * state of the parser changes. Throwing here leaves the parser
+   * unchanged, so the item can be decoded again.
+   */
+    virtual void completeItem(){};
+
+    /// Returns true, if the next event is decoded without reading input.
+    bool hasPendingEvent() const { return _pendingEnds != 0; };
+
+  private:
+    enum State {
+        STATE_HEADER,
+        STATE_CONTENT,
+        STATE_FINISHED
+    };
+
+    EventType processHeader();
+    EventType processContent();
+    EventType processElement();
+    void processAttributes();
+    EventType endElement();
+
+    State _state;
+
+    /// Elements started but not ended yet, the innermost last
+    std::vector<Element> _elements;
+    /// Number of END_ELEMENT events decoded but not returned yet
+    int _pendingEnds;
+
+    Element _element;
+    Attributes _attributes;
+    CharacterChunk _characterChunk;
+    Arena _callbackArena;
+};
+
+}  // namespace FI
+
+#endif
@@ -0,0 +1,119 @@
+/*=========================================================================
+     This file is part of the XIOT library.
+
+     Copyright (C) 2008-2009 EDF R&D
+     Author: Kristian Sons (xiot@actor3d.com)
+
+     This library is free software; you can redistribute it and/or modify
+     it under the terms of the GNU Lesser Public License as published by
+     the Free Software Foundation; either version 2.1 of the License, or
+     (at your option) any later version.
+
+     The XIOT library is distributed in the hope that it will be useful,
+     but WITHOUT ANY WARRANTY; without even the implied warranty of
+     MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+     GNU Lesser Public License for more details.
+
+     You should have received a copy of the GNU Lesser Public License
+     along with XIOT; if not, write to the Free Software
+     Foundation, Inc., 51 Franklin St, Fifth Floor, Boston,
+     MA 02110-1301  USA
+=========================================================================*/
+#ifndef FI_PUSHPARSER_H
+#define FI_PUSHPARSER_H
+
+#include <string>
+#include <vector>
+#include <xiot/FIInputSource.h>
+#include <xiot/FIPullParser.h>
+
+namespace FI {
+
+class ContentHandler;
+
+/**
+ * Incremental parser for Fast Infoset documents.
+ *
+ * While the SAXParser pulls the complete document from an InputSource,
+ * the PushParser is fed with chunks of the document as they arrive, e.g.
+ * from a network connection. Chunks may be of any size and split the
+ * document at any octet. The ContentHandler receives the same callbacks
+ * as from the SAXParser, each one as soon as the last octet of its item
+ * (start of an element with all attributes, character chunk, terminator)
+ * has been fed.
+ *
+ * An item that is split across chunks is decoded again from its first
+ * octet once the next chunk arrives. Only the octets of such an incomplete
+ * item are buffered, complete items are decoded in place from the chunk.
+ * The items are decoded by the PullParser, so the nesting depth of the
+ * document is not limited by the call stack.
+ *
+ * A PushParser decodes a single document. After an exception, the state
+ * of the parser is undefined.
+ *
+ * @see SAXParser
+ * @see PullParser
+ */
+class OPENFI_EXPORT PushParser : public PullParser {
+  public:
+    /// Constructor.
+    PushParser();
+    /// Destructor.
+    virtual ~PushParser();
+
+    void setContentHandler(ContentHandler *handler);
+
+    /**
+   * Decodes the next chunk of the document. The chunk is not referenced
+   * after the call returns.
+   *
+   * @param data The octets of the chunk
+   * @param length The number of octets
+   * @param isFinal true for the last chunk. Throws if the document is
+   * not complete then.
+   */
+    void parse(const void *data, size_t length, bool isFinal = false);
+
+    /// Returns true, if the document terminator has been decoded.
+    bool isFinished() const { return !hasNext(); };
+
+    /// Returns the number of octets of an incomplete item kept for the next chunk.
+    size_t getBufferedLength() const { return _buffer.size(); };
+
+  protected:
+    virtual void addAttributeValue(const FI::NonIdentifyingStringOrIndex &value);
+    virtual void addCharacterChunk(const FI::NonIdentifyingStringOrIndex &value);
+
+    /**
+   * Throws if the decoder read beyond the received octets. Otherwise
+   * adds the table entries of the item to the vocabulary.
+   */
+    virtual void completeItem();
+
+  private:
+    /**
+   * Delivers the received octets to the decoder and remembers if
+   * the decoder asked for more.
+   */
+    class Window : public MemoryInputSource {
+      public:
+        Window() : _exhausted(false){};
+        virtual bool nextBlock(const unsigned char *&begin, const unsigned char *&end);
+        bool _exhausted;
+    };
+
+    bool processItem(const unsigned char *begin, const unsigned char *end, size_t &consumed);
+    void dispatch(EventType event);
+
+    ContentHandler *_contentHandler;
+    Window _window;
+    std::vector<unsigned char> _buffer;
+
+    /// Table entries of the current item, added once it is complete
+    std::vector<std::string> _pendingAttributeValues;
+    std::vector<std::string> _pendingCharacterChunks;
+};
+
+}  // namespace FI
+
+#endif
@@ -44,7 +44,7 @@ class ParserVocabulary;
 class OPENFI_EXPORT SAXParser : public Decoder {
   public:
     /// Constructor.
-    SAXParser(){};
+    SAXParser();
     /// Destructor.
     virtual ~SAXParser();
 
@@ -52,10 +52,25 @@ class OPENFI_EXPORT SAXParser : public Decoder {
 
     void setContentHandler(ContentHandler *handler);
 
+    /**
+   * Called from ContentHandler::startElement() to skip the children of the
+   * element. They are decoded without callbacks and their literal values
+   * are skipped by length, see Decoder::skipAttribute(). The endElement()
+   * callback of the element is still made.
+   */
+    void skipChildren() { _skipping = true; };
+
+    /**
+   * Returns the arena holding the attributes and character data while
+   * they are passed to the ContentHandler. It is reset after each
+   * callback, its counters can be used to monitor allocations.
+   */
+    const Arena &getArena() const { return _callbackArena; };
+
   protected:
     virtual void processDocument();
     virtual void processElement();
-    virtual void processAttributes();
+    virtual void processAttributes(const Element &element);
     virtual void processCharacterChunk();
 
     /**
@@ -64,9 +79,16 @@ class OPENFI_EXPORT SAXParser : public Decoder {
     ContentHandler *_contentHandler;
 
   private:
+    /// Skips the value of an attribute the handler is not interested in,
+    /// unless ContentHandler::isEncodedAttributeOfInterest() asks for it
+    bool getSkippedAttributeValue(const Element &element, Attribute &attribute);
+
     bool _terminated;
     bool _doubleTerminated;
+    /// true while decoding the children of a skipped element
+    bool _skipping;
     Attributes _attributes;
+    Arena _callbackArena;
 };
 
 }  // namespace FI
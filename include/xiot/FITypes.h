@@ -24,6 +24,8 @@
 
 #include <xiot/FIConfig.h>
 
+#include <algorithm>
+#include <cstddef>
 #include <exception>
 #include <sstream>
 #include <stdexcept>
@@ -57,17 +59,94 @@ enum EncodingFormat {
      */
 typedef std::vector<unsigned char> NonEmptyOctetString;
 
+/**
+ * Octets of a decoded EncodedCharacterString.
+ *
+ * If the Decoder reads from a contiguous InputSource (memory or memory
+ * mapped file), the octets are a view into the input and nothing is copied.
+ * Otherwise the SAXParser copies them into its arena. Such a view is valid
+ * at least for the duration of the ContentHandler callback receiving it.
+ * A handler that keeps the octets beyond the callback calls retain() to
+ * take a private copy. Without an arena the octets are owned by the
+ * OctetString.
+ *
+ * Copying a view results in another view of the same input.
+ */
+class OctetString {
+  public:
+    typedef const unsigned char *const_iterator;
+
+    OctetString() : _data(NULL), _length(0){};
+    /// Creates a view of the given octets.
+    OctetString(const NonEmptyOctetString &octets) : _data(octets.empty() ? NULL : &octets[0]), _length(octets.size()){};
+    OctetString(const OctetString &other) : _data(NULL), _length(0) { *this = other; };
+
+    OctetString &operator=(const OctetString &other) {
+        if (this == &other)
+            return *this;
+        if (other.isView())
+            setView(other._data, other._length);
+        else if (other._length)
+            std::copy(other.begin(), other.end(), allocate(other._length));
+        else
+            setView(NULL, 0);
+        return *this;
+    };
+
+    /// Makes this a view of the given memory.
+    void setView(const unsigned char *data, size_t length) {
+        _storage.clear();
+        _data = data;
+        _length = length;
+    };
+
+    /// Allocates owned storage for length octets and returns it for writing.
+    unsigned char *allocate(size_t length) {
+        _storage.resize(length);
+        _data = length ? &_storage[0] : NULL;
+        _length = length;
+        return &_storage[0];
+    };
+
+    /// Copies the octets of a view into owned storage.
+    void retain() {
+        if (isView()) {
+            // allocate() moves _data, so the view has to be read first
+            const unsigned char *data = _data;
+            size_t length = _length;
+            std::copy(data, data + length, allocate(length));
+        }
+    };
+
+    /// Returns true, if the octets are not owned but a view of the input.
+    bool isView() const { return _data != NULL && (_storage.empty() || _data != &_storage[0]); };
+
+    const unsigned char *data() const { return _data; };
+    size_t size() const { return _length; };
+    bool empty() const { return _length == 0; };
+    const unsigned char &front() const { return _data[0]; };
+    const unsigned char &operator[](size_t i) const { return _data[i]; };
+    const_iterator begin() const { return _data; };
+    const_iterator end() const { return _data + _length; };
+
+  private:
+    const unsigned char *_data;
+    size_t _length;
+    NonEmptyOctetString _storage;
+};
+
 /**
      * 7.17 The EncodedCharacterString type
 	 * @ingroup ASN1Types
      */
 struct EncodedCharacterString {
+    EncodedCharacterString() : _encodingFormat(ENCODINGFORMAT_UTF8), _encodingAlgorithm(0){};
     EncodingFormat _encodingFormat;
     union {
         int _restrictedAlphabet;
         int _encodingAlgorithm;
     };
-    NonEmptyOctetString _octets;
+    OctetString _octets;
 };
 
 /**
@@ -121,6 +200,9 @@ struct NonIdentifyingStringOrIndex {
 	 */
 struct CharacterChunk {
     NonIdentifyingStringOrIndex characterCodes;
+
+    /// Takes a private copy of octets referring to the input, see OctetString::retain()
+    void retain() { characterCodes._characterString._octets.retain(); };
 };
 
 
@@ -131,6 +213,9 @@ struct CharacterChunk {
 struct Attribute {
     QualifiedNameOrIndex _qualifiedName;
     NonIdentifyingStringOrIndex _normalizedValue;
+
+    /// Takes a private copy of octets referring to the input, see OctetString::retain()
+    void retain() { _normalizedValue._characterString._octets.retain(); };
 };
 
 typedef std::vector<Attribute> Attributes;
@@ -163,6 +163,12 @@ class XIOT_EXPORT X3DAttributes {
 
     // Multi Field
     /**
+   * Returns the values of the specified attribute as a std::vector<bool>.
+   * @param index The index of the attribute. Can be obtained using getAttributeIndex(int attributeID)
+   * @return Value of the specified attribute.
+   */
+    virtual void getMFBool(int index, MFBool &value) const = 0;
+    /**
    * Returns the values of the specified attribute as a std::vector<float>.
    * @param index The index of the attribute. Can be obtained using getAttributeIndex(int attributeID)
    * @return Value of the specified attribute.
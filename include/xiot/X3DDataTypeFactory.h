@@ -118,6 +118,12 @@ class XIOT_EXPORT X3DDataTypeFactory {
 
     // Multi Field
     /**
+   * Parses a given string and returns its value as a std::vector<bool>.
+   * @param const std::string &s The string to be parsed.
+   * @return Value of the string.
+   */
+    static void getMFBoolFromString(const std::string &s, MFBool &value);
+    /**
    * Parses a given string and returns its value as a std::vector<float>.
    * @param const std::string &s The string to be parsed.
    * @return Value of the string.
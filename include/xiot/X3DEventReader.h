@@ -0,0 +1,126 @@
+/*=========================================================================
+     This file is part of the XIOT library.
+
+     Copyright (C) 2008-2009 EDF R&D
+     Author: Kristian Sons (xiot@actor3d.com)
+
+     This library is free software; you can redistribute it and/or modify
+     it under the terms of the GNU Lesser Public License as published by
+     the Free Software Foundation; either version 2.1 of the License, or
+     (at your option) any later version.
+
+     The XIOT library is distributed in the hope that it will be useful,
+     but WITHOUT ANY WARRANTY; without even the implied warranty of
+     MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+     GNU Lesser Public License for more details.
+
+     You should have received a copy of the GNU Lesser Public License
+     along with XIOT; if not, write to the Free Software
+     Foundation, Inc., 51 Franklin St, Fifth Floor, Boston,
+     MA 02110-1301  USA
+=========================================================================*/
+#ifndef X3D_X3DEVENTREADER_H
+#define X3D_X3DEVENTREADER_H
+
+#include <string>
+#include <xiot/XIOTConfig.h>
+
+namespace XIOT {
+
+class X3DAttributes;
+
+/**
+ * Reader that returns the events of an X3D document on request.
+ *
+ * Instead of receiving callbacks in an X3DNodeHandler, the client asks
+ * for the next event with next(). So the client controls when the file
+ * is read, can do other work between two events and stop reading at any
+ * time.
+ *
+ * \code
+XIOT::X3DEventReader *reader = XIOT::X3DEventReader::create("scene.x3db");
+while (reader && reader->hasNext()) {
+  if (reader->next() == XIOT::X3DEventReader::START_ELEMENT && reader->getElementID() == XIOT::ID::Shape)
+    shapes++;
+}
+delete reader;
+   \endcode
+ *
+ * X3DFIEventReader reads binary and X3DXMLEventReader reads XML encoded files.
+ *
+ * @see X3DLoader
+ * @ingroup x3dloader
+ */
+class XIOT_EXPORT X3DEventReader {
+  public:
+    /// The events of a document
+    enum EventType {
+        START_DOCUMENT,
+        END_DOCUMENT,
+        START_ELEMENT,
+        END_ELEMENT,
+        CHARACTERS
+    };
+
+    /// Constructor.
+    X3DEventReader();
+    /// Destructor.
+    virtual ~X3DEventReader();
+
+    /**
+   * Creates the reader for the encoding given by the suffix of the file
+   * (x3d or x3db) and opens the file.
+   * @return The reader or NULL, if the file could not be opened
+   */
+    static X3DEventReader *create(const char *fileStr);
+
+    /**
+   * Opens the file. The first event is START_DOCUMENT.
+   * @return false, if the file could not be opened
+   */
+    virtual bool open(const char *fileStr) = 0;
+
+    /// Closes the file. Called by the destructor.
+    virtual void close() = 0;
+
+    /// Returns false, if END_DOCUMENT has been returned or no file is open.
+    virtual bool hasNext() const = 0;
+
+    /**
+   * Reads the next event.
+   * @exception X3DParseException If the document is malformed or there is no next event.
+   */
+    virtual EventType next() = 0;
+
+    /// Returns the type of the last event.
+    EventType getEventType() const { return _eventType; };
+
+    /**
+   * Returns the id of the element of a START_ELEMENT or END_ELEMENT event.
+   * @see X3DTypes::getElementByID()
+   */
+    int getElementID() const { return _elementID; };
+
+    /**
+   * Returns the attributes of a START_ELEMENT event. They are valid until
+   * the next call to next().
+   */
+    virtual const X3DAttributes &getAttributes() const = 0;
+
+    /// Returns the text of a CHARACTERS event.
+    virtual std::string getCharacters() const = 0;
+
+    /**
+   * Skips the children of the element of the last START_ELEMENT event.
+   * Afterwards the last event is the END_ELEMENT of this element.
+   */
+    void skipChildren();
+
+  protected:
+    EventType _eventType;
+    int _elementID;
+};
+
+}  // namespace XIOT
+
+#endif
@@ -31,7 +31,41 @@ class ParserVocabulary;
 
 namespace XIOT {
 
-class FIAttributeImpl;
+/**
+ * Keeps the index of the enclosing mesh while an FI document is decoded
+ *
+ * Points encoded with the MeshCoordinateAlgorithm are predicted along the
+ * coordIndex of the parent IndexedFaceSet or the index of the parent
+ * IndexedTriangleSet. The context has to see the start and end of every
+ * element; the index octets are copied if they are encoded with the
+ * MeshIndexAlgorithm and decoded when the points are requested.
+ *
+ * @see MeshCoordinateAlgorithm
+ * @ingroup x3dloader
+ */
+class XIOT_EXPORT X3DFIMeshContext {
+  public:
+    /// Constructor.
+    X3DFIMeshContext();
+
+    void startElement(int elementID, const FI::Attributes &attributes);
+    void endElement();
+    /// Forgets all meshes, e.g. for the next document
+    void clear();
+
+    /// Returns the index of the innermost mesh, NULL if there is none.
+    const std::vector<int> *getMeshIndex() const;
+
+  private:
+    struct Mesh {
+        int depth;
+        FI::OctetString octets;
+        bool decoded;
+        std::vector<int> index;
+    };
+    mutable std::vector<Mesh> _meshes;
+    int _depth;
+};
 
 /**
  * Stores the attributes of an Fi encoded XML element
@@ -48,14 +82,20 @@ class FIAttributeImpl;
  * done directly if possible, i.e. by using the encoding algorithms.
  * Otherwise it is delegated to the ParserVocabulary.
  *
+ * The class only refers to the attributes of the parser and is meant to be
+ * created on the stack for each element. Values are decoded into the
+ * vectors passed by the caller. The points of the MeshCoordinateAlgorithm
+ * also need the index of the parent mesh, which the X3DFIMeshContext copies
+ * and decodes once per mesh.
+ *
  * @see X3DAttributes
  * @see X3DParserVocabulary
  * @ingroup x3dloader
  */
 class XIOT_EXPORT X3DFIAttributes : public X3DAttributes {
   public:
-    /// Constructor.
-    X3DFIAttributes(const void *const attributes, const FI::ParserVocabulary *vocab);
+    /// Constructor. The mesh context is needed for the MeshCoordinateAlgorithm.
+    X3DFIAttributes(const void *const attributes, const FI::ParserVocabulary *vocab, const X3DFIMeshContext *meshContext = NULL);
 
     /// Destructor.
     virtual ~X3DFIAttributes();
@@ -81,6 +121,7 @@ class XIOT_EXPORT X3DFIAttributes : public X3DAttributes {
     virtual void getSFImage(int index, SFImage &value) const;
 
     // Multi Field
+    virtual void getMFBool(int index, MFBool &value) const;
     virtual void getMFFloat(int index, MFFloat &value) const;
     virtual void getMFInt32(int index, MFInt32 &value) const;
     virtual void getMFVec3f(int index, MFVec3f &value) const;
@@ -90,11 +131,34 @@ class XIOT_EXPORT X3DFIAttributes : public X3DAttributes {
     virtual void getMFColor(int index, MFColor &value) const;
     virtual void getMFColorRGBA(int index, MFColorRGBA &value) const;
 
+    /**
+     * Returns the number of floats or ints of an array attribute, e.g. three
+     * per point of a MFVec3f. Arrays are not decoded for this if their
+     * codec has a getLength function, see X3DFICodec.
+     */
+    size_t getArrayLength(int index) const;
+
+    /**
+     * Decodes count floats of an array attribute, starting with float
+     * first. The range is clipped to the array. Of arrays encoded with the
+     * BlockzlibArrayAlgorithm only the blocks of the range are inflated,
+     * using up to threads threads (0 for one per processor). Other arrays
+     * are decoded completely.
+     */
+    void getFloatRange(int index, size_t first, size_t count, std::vector<float> &vec, int threads = 1) const;
+
+    /// Decodes count ints of an array attribute, see getFloatRange().
+    void getIntRange(int index, size_t first, size_t count, std::vector<int> &vec, int threads = 1) const;
+
   protected:
     void getFloatArray(const FI::NonIdentifyingStringOrIndex &value, std::vector<float> &vec) const;
     void getIntArray(const FI::NonIdentifyingStringOrIndex &value, std::vector<int> &vec) const;
+    /// Decodes the count floats of a single field, fieldType names it in the exception
+    void getSingleFloats(int index, float *values, size_t count, const char *fieldType) const;
 
-    FIAttributeImpl *_impl;
+    const FI::Attributes *_attributes;
+    const FI::ParserVocabulary *_vocab;
+    const X3DFIMeshContext *_meshContext;
 };
 
 };  // namespace XIOT
@@ -0,0 +1,141 @@
+/*=========================================================================
+     This file is part of the XIOT library.
+
+     Copyright (C) 2008-2009 EDF R&D
+     Author: Kristian Sons (xiot@actor3d.com)
+
+     This library is free software; you can redistribute it and/or modify
+     it under the terms of the GNU Lesser Public License as published by
+     the Free Software Foundation; either version 2.1 of the License, or
+     (at your option) any later version.
+
+     The XIOT library is distributed in the hope that it will be useful,
+     but WITHOUT ANY WARRANTY; without even the implied warranty of
+     MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+     GNU Lesser Public License for more details.
+
+     You should have received a copy of the GNU Lesser Public License
+     along with XIOT; if not, write to the Free Software
+     Foundation, Inc., 51 Franklin St, Fifth Floor, Boston,
+     MA 02110-1301  USA
+=========================================================================*/
+#ifndef X3D_X3DFICODECREGISTRY_H
+#define X3D_X3DFICODECREGISTRY_H
+
+#include <list>
+#include <vector>
+#include <xiot/FIEncodingAlgorithms.h>
+#include <xiot/FITypes.h>
+#include <xiot/X3DFIEncodingAlgorithms.h>
+#include <xiot/XIOTConfig.h>
+
+namespace XIOT {
+
+/**
+ * Settings of the X3DFIEncoder passed to the encode functions of a codec.
+ */
+struct XIOT_EXPORT CodecSettings {
+    CodecSettings() : stride(1){};
+
+    /// The number of floats per field value, e.g. 3 for MFVec3f
+    unsigned int stride;
+    FloatQuantization floatQuantization;
+    ParallelCompression parallelCompression;
+};
+
+/**
+ * Describes an encoding algorithm for int and/or float arrays.
+ *
+ * The functions a codec does not support are NULL, e.g. a codec for
+ * float arrays only has no int array functions. The algorithm resolves
+ * the octets to a string, it is put into the algorithm table of the
+ * X3DParserVocabulary.
+ *
+ * @see X3DFICodecRegistry
+ * @ingroup x3dloader
+ */
+struct XIOT_EXPORT X3DFICodec {
+    typedef void (*DecodeIntArrayFunction)(const FI::OctetString &octets, std::vector<int> &vec);
+    typedef void (*DecodeFloatArrayFunction)(const FI::OctetString &octets, std::vector<float> &vec);
+    typedef void (*EncodeIntArrayFunction)(const int *values, size_t size, FI::NonEmptyOctetString &octets, const CodecSettings &settings);
+    typedef void (*EncodeFloatArrayFunction)(const float *values, size_t size, FI::NonEmptyOctetString &octets, const CodecSettings &settings);
+    typedef size_t (*GetLengthFunction)(const FI::OctetString &octets);
+
+    X3DFICodec()
+        : uri(NULL), algorithmID(0), algorithm(NULL), decodeIntArray(NULL), decodeFloatArray(NULL), encodeIntArray(NULL), encodeFloatArray(NULL),
+          getLength(NULL){};
+
+    /// The URI used for the writer properties, NULL for the FI built-in algorithms
+    const char *uri;
+    /// The position in the FI algorithm table, 33 to 256 for application algorithms
+    int algorithmID;
+    FI::IEncodingAlgorithm *algorithm;
+
+    DecodeIntArrayFunction decodeIntArray;
+    DecodeFloatArrayFunction decodeFloatArray;
+    EncodeIntArrayFunction encodeIntArray;
+    EncodeFloatArrayFunction encodeFloatArray;
+    /// Returns the number of values without decoding them, optional
+    GetLengthFunction getLength;
+};
+
+/**
+ * The encoding algorithms known to the FI loaders and writers.
+ *
+ * The registry contains the FI built-in algorithms for int and float
+ * arrays and all XIOT algorithms. An application adds its own codecs
+ * before it creates the loaders and writers using them:
+ * \code
+XIOT::X3DFICodec codec;
+codec.uri = "encoder://example.org/MyFloatArrayEncoder";
+codec.algorithmID = 64;
+codec.algorithm = &myFloatArrayAlgorithm;
+codec.decodeFloatArray = &MyFloatArrayAlgorithm::decodeToFloatArray;
+codec.encodeFloatArray = &encodeMyFloatArray;
+XIOT::X3DFICodecRegistry::getInstance().registerCodec(codec);
+
+writer->setProperty(XIOT::Property::FloatEncodingAlgorithm, (void *)"encoder://example.org/MyFloatArrayEncoder");
+   \endcode
+ *
+ * The URI is not written to the document, so the reader has to register
+ * the codec with the same ID. The registry is not synchronized, codecs are
+ * expected to be registered before any thread loads or writes.
+ *
+ * @ingroup x3dloader
+ */
+class XIOT_EXPORT X3DFICodecRegistry {
+  public:
+    static X3DFICodecRegistry &getInstance();
+
+    /**
+     * Adds a codec. The algorithm and at least one decode function are
+     * required.
+     *
+     * @return false if the ID is out of range or taken, or if another codec
+     * encodes the same array type with the same URI
+     */
+    bool registerCodec(const X3DFICodec &codec);
+
+    /// Returns the codec with the ID, NULL if there is none. The codec stays
+    /// valid when other codecs are registered.
+    const X3DFICodec *findByID(int algorithmID) const;
+
+    /// Returns the codec encoding int arrays for the URI, NULL if there is none.
+    const X3DFICodec *findIntArrayEncoder(const char *uri) const;
+    /// Returns the codec encoding float arrays for the URI, NULL if there is none.
+    const X3DFICodec *findFloatArrayEncoder(const char *uri) const;
+
+    /// All codecs, ordered by ID.
+    const std::list<X3DFICodec> &getCodecs() const;
+
+  private:
+    X3DFICodecRegistry();
+    void add(const X3DFICodec &codec);
+
+    /// A list, so the codecs keep their address when codecs are inserted
+    std::list<X3DFICodec> _codecs;
+};
+
+}  // namespace XIOT
+
+#endif
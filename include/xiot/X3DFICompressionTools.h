@@ -22,6 +22,8 @@
 #ifndef X3D_FI_COMPRESSIONTOOLS_H
 #define X3D_FI_COMPRESSIONTOOLS_H
 
+#include <cstddef>
+#include <stdexcept>
 #include <vector>
 
 namespace XIOT {
@@ -32,33 +34,149 @@ namespace XIOT {
 	 */
 namespace FITools {
 
-struct BitPacker {
-    BitPacker();
-
-    void pack(unsigned long value, unsigned long num_bits_to_pack);
-    void get_result(char **data_return, int *len_return);
-
-    int next_bit_to_write;
-    std::vector<unsigned char> buffer;
+/**
+ * Writes values of up to 32 bits to a big-endian bit stream, the
+ * counterpart of the BitUnpacker.
+ */
+class BitPacker {
+  public:
+    BitPacker() : _bits(0), _count(0){};
+
+    /// Appends the lowest num_bits bits (0 to 32) of value.
+    inline void pack(unsigned long value, unsigned int num_bits) {
+        _bits = (_bits << num_bits) | (static_cast<Word>(value) & ((static_cast<Word>(1) << num_bits) - 1));
+        _count += num_bits;
+        while (_count >= 8) {
+            _count -= 8;
+            _buffer.push_back(static_cast<unsigned char>(_bits >> _count));
+        }
+    };
+
+    /// Pads the last octet with zero bits and returns the packed octets.
+    const std::vector<unsigned char> &getResult();
+
+  private:
+    typedef unsigned long long Word;
+    std::vector<unsigned char> _buffer;
+    /// The lowest _count bits are not written yet
+    Word _bits;
+    unsigned int _count;
 };
 
-struct BitUnpacker {
-    BitUnpacker(unsigned char *data, std::size_t len);
+/**
+ * Reads values of up to 32 bits from a big-endian bit stream. The bits are
+ * buffered in a 64 bit word that is refilled with up to eight octets at
+ * once. The data is not copied and has to stay valid.
+ */
+class BitUnpacker {
+  public:
+    /// Starts reading at bit firstBit of data.
+    BitUnpacker(const unsigned char *data, std::size_t len, unsigned int firstBit = 0);
+
+    /// Returns the next num_bits bits (0 to 32). Throws if there are not enough bits.
+    inline unsigned long unpack(unsigned int num_bits) {
+        if (_count < num_bits) {
+            refill();
+            if (_count < num_bits)
+                throw std::out_of_range("BitUnpacker: Unexpected end of data");
+        }
+        if (!num_bits)
+            return 0;
+        unsigned long result = static_cast<unsigned long>(_bits >> (64 - num_bits));
+        _bits <<= num_bits;
+        _count -= num_bits;
+        return result;
+    };
+
+    /// Returns the number of bits read from the beginning of the data.
+    std::size_t getBitPosition() const { return (_data - _begin) * 8 - _count; };
+
+  private:
+    inline void refill() {
+        if (_end - _data >= 8) {
+            // Fill the word completely, only whole octets count as read
+            Word word = 0;
+            for (int i = 0; i < 8; i++)
+                word = (word << 8) | _data[i];
+            _bits |= word >> _count;
+            _data += (63 - _count) >> 3;
+            _count |= 56;
+        } else {
+            while (_count <= 56 && _data < _end) {
+                _bits |= static_cast<Word>(*_data++) << (56 - _count);
+                _count += 8;
+            }
+        }
+    };
+
+    typedef unsigned long long Word;
+    const unsigned char *_begin;
+    const unsigned char *_data;
+    const unsigned char *_end;
+    /// The next bits, starting at the most significant bit
+    Word _bits;
+    /// The number of valid bits in _bits
+    unsigned int _count;
+};
 
-    void set_input(unsigned char *data, int len);
-    unsigned long unpack(unsigned long num_bits);
+/**
+ * Compresses length octets of data to a zlib stream, see compress2().
+ *
+ * With more than one thread and more than one block of data, the blocks
+ * are deflated concurrently and concatenated into a single zlib stream
+ * that any inflater can read, as done by pigz. Each block is primed with
+ * the preceding 32K of data, so the result is only slightly larger.
+ * Otherwise the result is the same as from compress2(). A thread count of
+ * 0 uses one thread per processor.
+ *
+ * @return false if zlib reports an error
+ */
+bool compress(const unsigned char *data, std::size_t length, std::vector<unsigned char> &result, int level, int threads = 1,
+              std::size_t blockSize = 131072);
 
-    unsigned int num_bits_remaining;
-    int next_bit_to_read;
+/**
+ * Calls task(context, i) for each i from 0 to count - 1. The calls are
+ * distributed round-robin over up to threads threads, 0 for one per
+ * processor, including the calling one. task must not throw.
+ */
+void parallelFor(std::size_t count, int threads, void (*task)(void *context, std::size_t index), void *context);
 
-    std::vector<unsigned char> buffer;
-};
+/// Returns the number of online processors, at least 1.
+int getNumberOfProcessors();
 
 class FloatPacker {
 
   public:
     FloatPacker(unsigned long exponentBits, unsigned long mantissaBits);
-    float decode(unsigned long src, bool isSigned = true);
+
+    inline float decode(unsigned long src, bool isSigned = true) const {
+        if (src == 0)
+            return 0.0f;
+
+        int mantissa = (src & _mantissa_mask);
+        int exponent = (int)(src & _exponent_mask) >> _mantissaBits;
+        long sign = (src >> _sign_shift);
+
+        // _exponent_min is negative, 127 is the exponent bias of 32 bit floats
+        exponent += _exponent_min + 127;
+
+        mantissa = mantissa << (23 - _mantissaBits);
+        union {
+            float f;
+            unsigned int ui;
+        } v;
+        v.ui = isSigned ? (sign << 31) | (exponent << 23) | (mantissa)
+                        : (exponent << 23) | (mantissa);
+        return v.f;
+    };
+
+    /**
+   * Returns the bits of the value, the mantissa is rounded to nearest.
+   * Values too small for the exponent bits become 0, values too large,
+   * infinity and NaN the largest value of the same sign. If isSigned is
+   * false, negative values become 0.
+   */
+    unsigned long encode(float value, bool isSigned = true) const;
 
   protected:
     unsigned long _exponentBits;
@@ -23,6 +23,8 @@
 #define X3D_X3DFIENCODER_H
 
 #include <xiot/FIEncoder.h>
+#include <xiot/X3DFICodecRegistry.h>
+#include <xiot/X3DFIEncodingAlgorithms.h>
 #include <xiot/XIOTConfig.h>
 
 namespace XIOT {
@@ -37,6 +39,8 @@ class XIOT_EXPORT X3DFIEncoder : public FI::FIEncoder {
 
     virtual void encodeAttributeIntegerArray(const int *values, size_t size);
     virtual void encodeAttributeFloatArray(const float *values, size_t size);
+    /// stride is the number of floats per field value, e.g. 3 for MFVec3f.
+    void encodeAttributeFloatArray(const float *values, size_t size, unsigned int stride);
 
     void setFloatAlgorithm(int algorithmID);
     void setIntAlgorithm(int algorithmID);
@@ -44,10 +48,28 @@ class XIOT_EXPORT X3DFIEncoder : public FI::FIEncoder {
     int getFloatAlgorithm() const;
     int getIntAlgorithm() const;
 
+    /// Quantization used with the QuantizedzlibFloatArrayAlgorithm.
+    void setFloatQuantization(const FloatQuantization &quantization);
+    const FloatQuantization &getFloatQuantization() const;
+
+    /// Threads and block size used to compress the arrays.
+    void setParallelCompression(const ParallelCompression &parallel);
+    const ParallelCompression &getParallelCompression() const;
+
+    /// Mesh encoding of IndexedFaceSet and IndexedTriangleSet, see X3DWriterFI.
+    void setMeshCompression(const MeshCompression &mesh);
+    const MeshCompression &getMeshCompression() const;
+
+    /// Encodes the index of a mesh with the MeshIndexAlgorithm.
+    void encodeAttributeMeshIndex(const int *values, size_t size);
+    /// Encodes the points of a mesh with the MeshCoordinateAlgorithm, see there.
+    void encodeAttributeMeshCoordinate(const float *values, size_t size, const std::vector<int> &index, unsigned int faceSize);
 
   protected:
     int _floatAlgorithm;
     int _intAlgorithm;
+    CodecSettings _codecSettings;
+    MeshCompression _meshCompression;
 };
 
 }  // namespace XIOT
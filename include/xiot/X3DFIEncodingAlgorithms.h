@@ -28,6 +28,27 @@
 
 namespace XIOT {
 
+/**
+ * Parallel compression of the zlib based encodings.
+ *
+ * Arrays longer than blockSize octets are split into blocks that are
+ * compressed concurrently by up to threads threads. The result is a single
+ * zlib stream that any decoder reads, see FITools::compress(). By default
+ * the arrays are compressed on the calling thread. For the
+ * BlockzlibArrayAlgorithm, blockSize is the size of its blocks as well.
+ *
+ * @see X3DWriterFI::setProperty()
+ * @ingroup x3dloader
+ */
+struct XIOT_EXPORT ParallelCompression {
+    ParallelCompression() : threads(1), blockSize(131072){};
+
+    /// The maximum number of threads, 0 for one per processor
+    int threads;
+    /// The size of the blocks in octets, at least 32K
+    size_t blockSize;
+};
+
 /**
  * Encoding algorithm to encode/decode arrays of type int.
  *
@@ -47,15 +68,56 @@ class XIOT_EXPORT DeltazlibIntArrayAlgorithm : public FI::IEncodingAlgorithm {
     /// The position of this algorithm in the FI algorithm table.
     static const int ALGORITHM_ID = 34;
 
-    virtual std::string decodeToString(const FI::NonEmptyOctetString &octets) const;
+    virtual std::string decodeToString(const FI::OctetString &octets) const;
 
     /**
 	 * Decodes a given vector of unsigned chars to a vector of int using the 
 	 * Delta zlib integer array decoder.
 	 */
-    static void decodeToIntArray(const FI::NonEmptyOctetString &octets, std::vector<int> &vec);
+    static void decodeToIntArray(const FI::OctetString &octets, std::vector<int> &vec);
+
+    static void encode(const int *values, size_t size, FI::NonEmptyOctetString &octets, bool isImage = false,
+                       const ParallelCompression &parallel = ParallelCompression());
+};
+
+/**
+ * Quantization of the QuantizedzlibFloatArrayAlgorithm encoding.
+ *
+ * By default the floats are encoded losslessly with 8 exponent and
+ * 23 mantissa bits. Fewer bits make the encoding lossy but the stream
+ * shorter. The bits can be given directly or derived for each array
+ * from the maximum error allowed:
+ * \code
+XIOT::FloatQuantization q = XIOT::FloatQuantization::fromRelativeError(1e-4f);
+writer->setProperty(XIOT::Property::FloatQuantization, &q);
+   \endcode
+ *
+ * @see X3DWriterFI::setProperty()
+ * @ingroup x3dloader
+ */
+struct XIOT_EXPORT FloatQuantization {
+    enum Mode {
+        /// Lossless, 8 exponent and 23 mantissa bits
+        LOSSLESS,
+        /// exponentBits and mantissaBits are used for all arrays
+        BITS,
+        /// The relative error of each value is at most maxError
+        RELATIVE_ERROR,
+        /// The absolute error of each value is at most maxError
+        ABSOLUTE_ERROR
+    };
+
+    FloatQuantization() : mode(LOSSLESS), exponentBits(8), mantissaBits(23), maxError(0){};
+
+    /// Exponent bits from 1 to 8, mantissa bits from 0 to 23.
+    static FloatQuantization fromBits(int exponentBits, int mantissaBits);
+    static FloatQuantization fromRelativeError(float maxError);
+    static FloatQuantization fromAbsoluteError(float maxError);
 
-    static void encode(const int *values, size_t size, FI::NonEmptyOctetString &octets, bool isImage = false);
+    Mode mode;
+    int exponentBits;
+    int mantissaBits;
+    float maxError;
 };
 
 /**
@@ -75,17 +137,251 @@ class XIOT_EXPORT QuantizedzlibFloatArrayAlgorithm : public FI::IEncodingAlgorit
     /// The position of this algorithm in the FI algorithm table.
     static const int ALGORITHM_ID = 35;
 
-    virtual std::string decodeToString(const FI::NonEmptyOctetString &octets) const;
+    virtual std::string decodeToString(const FI::OctetString &octets) const;
 
     /**
 	 * Decodes a given vector of unsigned chars to a vector of float using the 
 	 * Quantized zlib float array encoder.
 	 */
-    static void decodeToFloatArray(const FI::NonEmptyOctetString &octets, std::vector<float> &vec);
+    static void decodeToFloatArray(const FI::OctetString &octets, std::vector<float> &vec);
 
     static void encode(const float *values, size_t size, FI::NonEmptyOctetString &octets);
+
+    /**
+	 * Encodes the values with the given quantization. Values that are not
+	 * representable with the derived bits are clamped, see
+	 * FITools::FloatPacker::encode().
+	 */
+    static void encode(const float *values, size_t size, FI::NonEmptyOctetString &octets, const FloatQuantization &quantization,
+                       const ParallelCompression &parallel = ParallelCompression());
 };
 
+/**
+ * Encoding algorithm to encode/decode arrays of type float or int in
+ * independently compressed blocks.
+ *
+ * This is an XIOT specific algorithm, it is not part of ISO/IEC 19776-3
+ * and other decoders do not know it. In contrast to the algorithms above,
+ * a range of values can be decoded without inflating the whole array, and
+ * the blocks can be inflated in parallel.
+ *
+ * All numbers are big-endian. The octets are:
+ * - the type, 0 for float and 1 for int arrays
+ * - the span of the int deltas, see DeltazlibIntArrayAlgorithm, 0 for none
+ * - the number of values (4 octets)
+ * - the number of values per block (4 octets)
+ * - for each block the end of its data, counted from the first block (4 octets)
+ * - for each block a zlib stream of its values as 32 bit words. Each
+ *   block starts with span values that are not delta encoded.
+ *
+ * The URI for identifying this encoder is: "encoder://xiot/BlockzlibArrayEncoder"
+ *
+ * @ingroup x3dloader
+ */
+class XIOT_EXPORT BlockzlibArrayAlgorithm : public FI::IEncodingAlgorithm {
+  public:
+    /// The position of this algorithm in the FI algorithm table.
+    static const int ALGORITHM_ID = 36;
+
+    virtual std::string decodeToString(const FI::OctetString &octets) const;
+
+    /// Returns the number of values in the array.
+    static size_t getLength(const FI::OctetString &octets);
+
+    /// Returns true for float, false for int arrays.
+    static bool isFloatArray(const FI::OctetString &octets);
+
+    /**
+	 * Decodes count values, starting with value first. The range is clipped
+	 * to the array. Only the blocks of the range are inflated, using up to
+	 * threads threads (0 for one per processor).
+	 */
+    static void decodeToFloatArray(const FI::OctetString &octets, std::vector<float> &vec, size_t first = 0, size_t count = static_cast<size_t>(-1),
+                                   int threads = 1);
+    static void decodeToIntArray(const FI::OctetString &octets, std::vector<int> &vec, size_t first = 0, size_t count = static_cast<size_t>(-1),
+                                 int threads = 1);
+
+    /**
+	 * Encodes the values in blocks of parallel.blockSize octets, compressed
+	 * by up to parallel.threads threads.
+	 */
+    static void encode(const float *values, size_t size, FI::NonEmptyOctetString &octets, const ParallelCompression &parallel = ParallelCompression());
+    static void encode(const int *values, size_t size, FI::NonEmptyOctetString &octets, const ParallelCompression &parallel = ParallelCompression());
+};
+
+/**
+ * Lossless encoding algorithm for arrays of type float.
+ *
+ * This is an XIOT specific algorithm, it is not part of ISO/IEC 19776-3
+ * and other decoders do not know it. Each float is predicted by the float
+ * one stride before it, e.g. the same coordinate of the previous point of
+ * a MFVec3f, and replaced by the XOR of both. The residuals are split into
+ * four byte planes, so that the similar sign and exponent bytes are next
+ * to each other, and compressed with zlib.
+ *
+ * All numbers are big-endian. The octets are:
+ * - the stride, 3 for MFVec3f and MFColor, 2 for MFVec2f, 4 for MFRotation
+ * - the number of floats (4 octets)
+ * - a zlib stream of the most significant byte of all residuals, followed
+ *   by the second byte of all residuals and so on
+ *
+ * The URI for identifying this encoder is: "encoder://xiot/ShufflezlibFloatArrayEncoder"
+ *
+ * @ingroup x3dloader
+ */
+class XIOT_EXPORT ShufflezlibFloatArrayAlgorithm : public FI::IEncodingAlgorithm {
+  public:
+    /// The position of this algorithm in the FI algorithm table.
+    static const int ALGORITHM_ID = 37;
+
+    virtual std::string decodeToString(const FI::OctetString &octets) const;
+
+    /// Returns the number of floats in the array.
+    static size_t getLength(const FI::OctetString &octets);
+
+    static void decodeToFloatArray(const FI::OctetString &octets, std::vector<float> &vec);
+
+    /// Encodes the values, stride is the number of floats per field value (1 to 255).
+    static void encode(const float *values, size_t size, FI::NonEmptyOctetString &octets, unsigned int stride = 1,
+                       const ParallelCompression &parallel = ParallelCompression());
+};
+
+/**
+ * Lossless encoding algorithm for the index of an IndexedFaceSet
+ * (coordIndex) or IndexedTriangleSet (index).
+ *
+ * This is an XIOT specific algorithm, it is not part of ISO/IEC 19776-3
+ * and other decoders do not know it. The index is coded in its original
+ * order, one code octet per value: 0 for -1, 1 for the vertex following
+ * the highest vertex so far, 2 to 33 for the position of the vertex in a
+ * move-to-front list of the last 32 vertices, and 255 for a vertex that is
+ * stored explicitly. The MeshCoordinateAlgorithm uses the decoded index to
+ * predict the points.
+ *
+ * All numbers are big-endian. The octets are:
+ * - the number of values (4 octets)
+ * - the number of explicit vertices (4 octets)
+ * - a zlib stream of the codes, followed by the explicit vertices as zig-zag
+ *   encoded differences to the vertex following the highest one (4 octets)
+ *
+ * The URI for identifying this encoder is: "encoder://xiot/MeshIndexEncoder"
+ *
+ * @ingroup x3dloader
+ */
+class XIOT_EXPORT MeshIndexAlgorithm : public FI::IEncodingAlgorithm {
+  public:
+    /// The position of this algorithm in the FI algorithm table.
+    static const int ALGORITHM_ID = 38;
+
+    virtual std::string decodeToString(const FI::OctetString &octets) const;
+
+    static void decodeToIntArray(const FI::OctetString &octets, std::vector<int> &vec);
+
+    static void encode(const int *values, size_t size, FI::NonEmptyOctetString &octets);
+};
+
+/**
+ * Lossy encoding algorithm for the points of the Coordinate node of an
+ * IndexedFaceSet or IndexedTriangleSet, using the index of the mesh.
+ *
+ * This is an XIOT specific algorithm, it is not part of ISO/IEC 19776-3
+ * and other decoders do not know it. The points are quantized to a grid of
+ * bits bits over their bounding box. They are visited in the order of their
+ * first use in the index and each one is predicted from the points visited
+ * before it: by the parallelogram spanned by the triangle across the edge
+ * it faces, if there is one, otherwise by a neighbour in its face. Polygons
+ * are split into triangle fans. Points not used by the index follow in
+ * their order. Only the differences to the predictions are stored.
+ *
+ * The index is not part of the encoding. The X3DFIAttributes of the
+ * Coordinate node get it from the parent node, see X3DFIMeshContext.
+ *
+ * All numbers are big-endian. The octets are:
+ * - the face size, 0 for faces ended by -1, 3 for triangles
+ * - the number of bits per component, 1 to 30
+ * - the number of points (4 octets)
+ * - the minimum of the points and the size of the grid as floats (16 octets)
+ * - a zlib stream of four byte planes of the zig-zag encoded differences,
+ *   the most significant first
+ *
+ * The URI for identifying this encoder is: "encoder://xiot/MeshCoordinateEncoder"
+ *
+ * @ingroup x3dloader
+ */
+class XIOT_EXPORT MeshCoordinateAlgorithm : public FI::IEncodingAlgorithm {
+  public:
+    /// The position of this algorithm in the FI algorithm table.
+    static const int ALGORITHM_ID = 39;
+
+    /// Not supported without the index, throws a X3DParseException.
+    virtual std::string decodeToString(const FI::OctetString &octets) const;
+
+    /// Returns the number of floats in the array, three per point.
+    static size_t getLength(const FI::OctetString &octets);
+
+    /// Decodes the points, index is the decoded index of the mesh.
+    static void decodeToFloatArray(const FI::OctetString &octets, const std::vector<int> &index, std::vector<float> &vec);
+
+    /**
+	 * Encodes size / 3 points, size has to be a multiple of 3. faceSize is 0
+	 * for an index of faces ended by -1 and 3 for triangles, bits is the
+	 * number of bits per component (1 to 30).
+	 */
+    static void encode(const float *values, size_t size, const std::vector<int> &index, unsigned int faceSize, unsigned int bits,
+                       FI::NonEmptyOctetString &octets);
+};
+
+/**
+ * Mesh aware encoding of IndexedFaceSet and IndexedTriangleSet nodes.
+ *
+ * If coordinateBits is not 0, the X3DWriterFI encodes the index of these
+ * nodes with the MeshIndexAlgorithm and the points of their Coordinate
+ * child with the MeshCoordinateAlgorithm, quantized to coordinateBits bits
+ * (1 to 30) per component.
+ *
+ * @see X3DWriterFI::setProperty()
+ * @ingroup x3dloader
+ */
+struct XIOT_EXPORT MeshCompression {
+    MeshCompression() : coordinateBits(0){};
+
+    int coordinateBits;
+};
+
+/**
+ * Lossless encoding algorithm for int arrays, an alternative to the
+ * DeltazlibIntArrayAlgorithm.
+ *
+ * This is an XIOT specific algorithm, it is not part of ISO/IEC 19776-3
+ * and other decoders do not know it. Like the DeltazlibIntArrayAlgorithm
+ * each value is predicted by the value span positions before it, with
+ * span being the size of the first face of an index. The differences are
+ * zig-zag encoded and written as varints of 7 bits per octet, the lowest
+ * first, so the typical small differences of an index take one octet
+ * instead of four. zlib is applied to the varints.
+ *
+ * All numbers are big-endian. The octets are:
+ * - the number of values (4 octets)
+ * - the number of varint octets (4 octets)
+ * - span (1 octet)
+ * - a zlib stream of the varints
+ *
+ * The URI for identifying this encoder is: "encoder://xiot/VarintzlibIntArrayEncoder"
+ *
+ * @ingroup x3dloader
+ */
+class XIOT_EXPORT VarintzlibIntArrayAlgorithm : public FI::IEncodingAlgorithm {
+  public:
+    /// The position of this algorithm in the FI algorithm table.
+    static const int ALGORITHM_ID = 40;
+
+    virtual std::string decodeToString(const FI::OctetString &octets) const;
+
+    static void decodeToIntArray(const FI::OctetString &octets, std::vector<int> &vec);
+
+    static void encode(const int *values, size_t size, FI::NonEmptyOctetString &octets,
+                       const ParallelCompression &parallel = ParallelCompression());
+};
 
 };  // namespace XIOT
 
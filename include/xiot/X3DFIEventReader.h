@@ -0,0 +1,77 @@
+/*=========================================================================
+     This file is part of the XIOT library.
+
+     Copyright (C) 2008-2009 EDF R&D
+     Author: Kristian Sons (xiot@actor3d.com)
+
+     This library is free software; you can redistribute it and/or modify
+     it under the terms of the GNU Lesser Public License as published by
+     the Free Software Foundation; either version 2.1 of the License, or
+     (at your option) any later version.
+
+     The XIOT library is distributed in the hope that it will be useful,
+     but WITHOUT ANY WARRANTY; without even the implied warranty of
+     MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+     GNU Lesser Public License for more details.
+
+     You should have received a copy of the GNU Lesser Public License
+     along with XIOT; if not, write to the Free Software
+     Foundation, Inc., 51 Franklin St, Fifth Floor, Boston,
+     MA 02110-1301  USA
+=========================================================================*/
+#ifndef X3D_X3DFIEVENTREADER_H
+#define X3D_X3DFIEVENTREADER_H
+
+#include <fstream>
+#include <xiot/FIInputSource.h>
+#include <xiot/X3DEventReader.h>
+#include <xiot/X3DFIAttributes.h>
+
+namespace FI {
+class PullParser;
+}
+
+namespace XIOT {
+
+/**
+ * Event reader for FI (binary) encoded X3D files.
+ *
+ * The events are decoded by the FI::PullParser, so only the octets of the
+ * next item are read from the file when next() is called. Character chunks
+ * that contain only whitespace are skipped.
+ *
+ * @see X3DEventReader
+ * @see X3DFILoader
+ * @ingroup x3dloader
+ */
+class XIOT_EXPORT X3DFIEventReader : public X3DEventReader {
+  public:
+    /// Constructor.
+    X3DFIEventReader();
+    /// Destructor.
+    virtual ~X3DFIEventReader();
+
+    virtual bool open(const char *fileStr);
+    virtual void close();
+    virtual bool hasNext() const;
+    virtual EventType next();
+    virtual const X3DAttributes &getAttributes() const;
+    virtual std::string getCharacters() const;
+
+    /// @see X3DFILoader::setMemoryMapping()
+    void setMemoryMapping(bool enabled) { _memoryMapping = enabled; };
+    bool getMemoryMapping() const { return _memoryMapping; };
+
+  private:
+    FI::PullParser *_parser;
+    FI::MemoryMappedInputSource _mappedFile;
+    std::ifstream _file;
+    X3DFIAttributes _attributes;
+    X3DFIMeshContext _meshContext;
+    std::string _characters;
+    bool _memoryMapping;
+};
+
+}  // namespace XIOT
+
+#endif
@@ -30,6 +30,11 @@
 #include <xiot/X3DNodeHandler.h>
 #include <xiot/X3DSwitch.h>
 
+namespace FI {
+class ContentHandler;
+class PushParser;
+}  // namespace FI
+
 namespace XIOT {
 
 /**  
@@ -53,12 +58,39 @@ class XIOT_EXPORT X3DFILoader : public X3DLoader {
    */
     bool load(const char *fileStr, bool fileValidation = true);  // C.2
 
+    /**
+   * If enabled (default), regular files are mapped into memory and decoded
+   * in place. Otherwise or if mapping fails, the file is read through a
+   * std::ifstream in large blocks.
+   */
+    void setMemoryMapping(bool enabled) { _memoryMapping = enabled; };
+    bool getMemoryMapping() const { return _memoryMapping; };
+
+    /**
+   * Decodes a document received in chunks, e.g. from a network connection.
+   * The X3DNodeHandler receives the events of a node as soon as its data is
+   * complete. Chunks may be of any size and split the document at any byte.
+   * The first call starts a new document, the call with isFinal set ends it.
+   * If a callback returns ABORT, the following chunks up to the one with
+   * isFinal set are ignored.
+   *
+   * @return false, if decoding failed. The next call starts a new document then.
+   * @see FI::PushParser
+   */
+    bool loadChunk(const char *data, size_t length, bool isFinal = false);
 
   protected:
   private:
+    void endChunkedLoad();
+
     std::ifstream file;
     X3DNodeHandler *handler;
     X3DSwitch x3dswitch;
+    bool _memoryMapping;
+
+    FI::PushParser *_pushParser;
+    FI::ContentHandler *_pushHandler;
+    bool _chunkAborted;
 };
 
 }  // namespace XIOT
@@ -0,0 +1,460 @@
+/*=========================================================================
+     This file is part of the XIOT library.
+
+     Copyright (C) 2008-2009 EDF R&D
+     Author: Kristian Sons (xiot@actor3d.com)
+
+     This library is free software; you can redistribute it and/or modify
+     it under the terms of the GNU Lesser Public License as published by
+     the Free Software Foundation; either version 2.1 of the License, or
+     (at your option) any later version.
+
+     The XIOT library is distributed in the hope that it will be useful,
+     but WITHOUT ANY WARRANTY; without even the implied warranty of
+     MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+     GNU Lesser Public License for more details.
+
+     You should have received a copy of the GNU Lesser Public License
+     along with XIOT; if not, write to the Free Software
+     Foundation, Inc., 51 Franklin St, Fifth Floor, Boston,
+     MA 02110-1301  USA
+=========================================================================*/
+#ifndef X3D_X3DINTERESTMASK_H
+#define X3D_X3DINTERESTMASK_H
+
+#include <map>
+#include <vector>
+#include <xiot/X3DDefaultNodeHandler.h>
+#include <xiot/X3DTypes.h>
+#include <xiot/XIOTConfig.h>
+
+namespace XIOT {
+
+/**
+ * Set of the nodes, and optionally their attributes, a X3DNodeHandler is
+ * interested in.
+ *
+ * If a mask is set on a loader, the callbacks of nodes outside the mask
+ * are not called and no X3DAttributes are created for them. The children
+ * of such nodes are processed as usual. The FI loader additionally skips
+ * the values of attributes outside the mask without decoding them; the
+ * XML loaders report all attributes of the nodes in the mask.
+ *
+ * A mask for a handler derived from X3DDefaultNodeHandler can be created
+ * from the callbacks the handler overrides:
+ * \code
+XIOT::X3DInterestMask mask = XIOT::X3DInterestMask::fromHandler<MyShapeCounter>();
+loader.setInterestMask(&mask);
+   \endcode
+ *
+ * @see X3DLoader::setInterestMask()
+ * @ingroup x3dloader
+ */
+class XIOT_EXPORT X3DInterestMask {
+  public:
+    /// Constructor. The mask is empty.
+    X3DInterestMask();
+    /// Destructor.
+    ~X3DInterestMask();
+
+    /// Adds a node, -1 stands for all unknown nodes (handled by startUnknown()).
+    void addNode(int nodeID);
+
+    /// Adds all nodes, including unknown ones.
+    void addAllNodes();
+
+    /**
+   * Adds an attribute of a node and the node itself. Once an attribute
+   * of a node is added, the other attributes of the node are not of
+   * interest anymore.
+   */
+    void addAttribute(int nodeID, int attributeID);
+
+    /// Returns true, if the callbacks of the node are of interest. Ids out of range are unknown nodes.
+    bool hasNode(int nodeID) const {
+        return (nodeID >= 0 && nodeID < ID::X3DELEMENT_COUNT) ? _nodes[nodeID + 1] : _nodes[0];
+    };
+
+    /// Returns true, if the node and the given attribute of it are of interest.
+    bool hasAttribute(int nodeID, int attributeID) const;
+
+    /**
+   * Creates the mask of the nodes whose start or end callback is
+   * overridden by the handler class H. If H overrides startUnhandled()
+   * or endUnhandled(), all nodes are of interest.
+   */
+    template <class H>
+    static X3DInterestMask fromHandler();
+
+  private:
+    /// Indexed by node id + 1
+    std::vector<bool> _nodes;
+    /// Attributes of the nodes with restricted attributes
+    std::map<int, std::vector<bool> > _attributes;
+
+    template <class F>
+    static bool overrides(F X3DDefaultNodeHandler::*) { return false; };
+    template <class C, class F>
+    static bool overrides(F C::*) { return true; };
+};
+
+template <class H>
+X3DInterestMask X3DInterestMask::fromHandler() {
+    X3DInterestMask mask;
+    if (overrides(&H::startUnhandled) || overrides(&H::endUnhandled)) {
+        mask.addAllNodes();
+        return mask;
+    }
+    if (overrides(&H::startUnknown) || overrides(&H::endUnknown))
+        mask.addNode(-1);
+
+    // START GENERATED
+    if (overrides(&H::startShape) || overrides(&H::endShape))
+        mask.addNode(ID::Shape);
+    if (overrides(&H::startAppearance) || overrides(&H::endAppearance))
+        mask.addNode(ID::Appearance);
+    if (overrides(&H::startMaterial) || overrides(&H::endMaterial))
+        mask.addNode(ID::Material);
+    if (overrides(&H::startIndexedFaceSet) || overrides(&H::endIndexedFaceSet))
+        mask.addNode(ID::IndexedFaceSet);
+    if (overrides(&H::startProtoInstance) || overrides(&H::endProtoInstance))
+        mask.addNode(ID::ProtoInstance);
+    if (overrides(&H::startTransform) || overrides(&H::endTransform))
+        mask.addNode(ID::Transform);
+    if (overrides(&H::startImageTexture) || overrides(&H::endImageTexture))
+        mask.addNode(ID::ImageTexture);
+    if (overrides(&H::startTextureTransform) || overrides(&H::endTextureTransform))
+        mask.addNode(ID::TextureTransform);
+    if (overrides(&H::startCoordinate) || overrides(&H::endCoordinate))
+        mask.addNode(ID::Coordinate);
+    if (overrides(&H::startNormal) || overrides(&H::endNormal))
+        mask.addNode(ID::Normal);
+    if (overrides(&H::startColor) || overrides(&H::endColor))
+        mask.addNode(ID::Color);
+    if (overrides(&H::startColorRGBA) || overrides(&H::endColorRGBA))
+        mask.addNode(ID::ColorRGBA);
+    if (overrides(&H::startTextureCoordinate) || overrides(&H::endTextureCoordinate))
+        mask.addNode(ID::TextureCoordinate);
+    if (overrides(&H::startROUTE) || overrides(&H::endROUTE))
+        mask.addNode(ID::ROUTE);
+    if (overrides(&H::startfieldValue) || overrides(&H::endfieldValue))
+        mask.addNode(ID::fieldValue);
+    if (overrides(&H::startGroup) || overrides(&H::endGroup))
+        mask.addNode(ID::Group);
+    if (overrides(&H::startLOD) || overrides(&H::endLOD))
+        mask.addNode(ID::LOD);
+    if (overrides(&H::startSwitch) || overrides(&H::endSwitch))
+        mask.addNode(ID::Switch);
+    if (overrides(&H::startScript) || overrides(&H::endScript))
+        mask.addNode(ID::Script);
+    if (overrides(&H::startIndexedTriangleFanSet) || overrides(&H::endIndexedTriangleFanSet))
+        mask.addNode(ID::IndexedTriangleFanSet);
+    if (overrides(&H::startIndexedTriangleSet) || overrides(&H::endIndexedTriangleSet))
+        mask.addNode(ID::IndexedTriangleSet);
+    if (overrides(&H::startIndexedTriangleStripSet) || overrides(&H::endIndexedTriangleStripSet))
+        mask.addNode(ID::IndexedTriangleStripSet);
+    if (overrides(&H::startMultiTexture) || overrides(&H::endMultiTexture))
+        mask.addNode(ID::MultiTexture);
+    if (overrides(&H::startMultiTextureCoordinate) || overrides(&H::endMultiTextureCoordinate))
+        mask.addNode(ID::MultiTextureCoordinate);
+    if (overrides(&H::startMultiTextureTransform) || overrides(&H::endMultiTextureTransform))
+        mask.addNode(ID::MultiTextureTransform);
+    if (overrides(&H::startIndexedLineSet) || overrides(&H::endIndexedLineSet))
+        mask.addNode(ID::IndexedLineSet);
+    if (overrides(&H::startPointSet) || overrides(&H::endPointSet))
+        mask.addNode(ID::PointSet);
+    if (overrides(&H::startStaticGroup) || overrides(&H::endStaticGroup))
+        mask.addNode(ID::StaticGroup);
+    if (overrides(&H::startSphere) || overrides(&H::endSphere))
+        mask.addNode(ID::Sphere);
+    if (overrides(&H::startBox) || overrides(&H::endBox))
+        mask.addNode(ID::Box);
+    if (overrides(&H::startCone) || overrides(&H::endCone))
+        mask.addNode(ID::Cone);
+    if (overrides(&H::startAnchor) || overrides(&H::endAnchor))
+        mask.addNode(ID::Anchor);
+    if (overrides(&H::startArc2D) || overrides(&H::endArc2D))
+        mask.addNode(ID::Arc2D);
+    if (overrides(&H::startArcClose2D) || overrides(&H::endArcClose2D))
+        mask.addNode(ID::ArcClose2D);
+    if (overrides(&H::startAudioClip) || overrides(&H::endAudioClip))
+        mask.addNode(ID::AudioClip);
+    if (overrides(&H::startBackground) || overrides(&H::endBackground))
+        mask.addNode(ID::Background);
+    if (overrides(&H::startBillboard) || overrides(&H::endBillboard))
+        mask.addNode(ID::Billboard);
+    if (overrides(&H::startBooleanFilter) || overrides(&H::endBooleanFilter))
+        mask.addNode(ID::BooleanFilter);
+    if (overrides(&H::startBooleanSequencer) || overrides(&H::endBooleanSequencer))
+        mask.addNode(ID::BooleanSequencer);
+    if (overrides(&H::startBooleanToggle) || overrides(&H::endBooleanToggle))
+        mask.addNode(ID::BooleanToggle);
+    if (overrides(&H::startBooleanTrigger) || overrides(&H::endBooleanTrigger))
+        mask.addNode(ID::BooleanTrigger);
+    if (overrides(&H::startCircle2D) || overrides(&H::endCircle2D))
+        mask.addNode(ID::Circle2D);
+    if (overrides(&H::startCollision) || overrides(&H::endCollision))
+        mask.addNode(ID::Collision);
+    if (overrides(&H::startColorInterpolator) || overrides(&H::endColorInterpolator))
+        mask.addNode(ID::ColorInterpolator);
+    if (overrides(&H::startContour2D) || overrides(&H::endContour2D))
+        mask.addNode(ID::Contour2D);
+    if (overrides(&H::startContourPolyline2D) || overrides(&H::endContourPolyline2D))
+        mask.addNode(ID::ContourPolyline2D);
+    if (overrides(&H::startCoordinateDouble) || overrides(&H::endCoordinateDouble))
+        mask.addNode(ID::CoordinateDouble);
+    if (overrides(&H::startCoordinateInterpolator) || overrides(&H::endCoordinateInterpolator))
+        mask.addNode(ID::CoordinateInterpolator);
+    if (overrides(&H::startCoordinateInterpolator2D) || overrides(&H::endCoordinateInterpolator2D))
+        mask.addNode(ID::CoordinateInterpolator2D);
+    if (overrides(&H::startCylinder) || overrides(&H::endCylinder))
+        mask.addNode(ID::Cylinder);
+    if (overrides(&H::startCylinderSensor) || overrides(&H::endCylinderSensor))
+        mask.addNode(ID::CylinderSensor);
+    if (overrides(&H::startDirectionalLight) || overrides(&H::endDirectionalLight))
+        mask.addNode(ID::DirectionalLight);
+    if (overrides(&H::startDisk2D) || overrides(&H::endDisk2D))
+        mask.addNode(ID::Disk2D);
+    if (overrides(&H::startEXPORT) || overrides(&H::endEXPORT))
+        mask.addNode(ID::EXPORT);
+    if (overrides(&H::startElevationGrid) || overrides(&H::endElevationGrid))
+        mask.addNode(ID::ElevationGrid);
+    if (overrides(&H::startEspduTransform) || overrides(&H::endEspduTransform))
+        mask.addNode(ID::EspduTransform);
+    if (overrides(&H::startExternProtoDeclare) || overrides(&H::endExternProtoDeclare))
+        mask.addNode(ID::ExternProtoDeclare);
+    if (overrides(&H::startExtrusion) || overrides(&H::endExtrusion))
+        mask.addNode(ID::Extrusion);
+    if (overrides(&H::startFillProperties) || overrides(&H::endFillProperties))
+        mask.addNode(ID::FillProperties);
+    if (overrides(&H::startFog) || overrides(&H::endFog))
+        mask.addNode(ID::Fog);
+    if (overrides(&H::startFontStyle) || overrides(&H::endFontStyle))
+        mask.addNode(ID::FontStyle);
+    if (overrides(&H::startGeoCoordinate) || overrides(&H::endGeoCoordinate))
+        mask.addNode(ID::GeoCoordinate);
+    if (overrides(&H::startGeoElevationGrid) || overrides(&H::endGeoElevationGrid))
+        mask.addNode(ID::GeoElevationGrid);
+    if (overrides(&H::startGeoLOD) || overrides(&H::endGeoLOD))
+        mask.addNode(ID::GeoLOD);
+    if (overrides(&H::startGeoLocation) || overrides(&H::endGeoLocation))
+        mask.addNode(ID::GeoLocation);
+    if (overrides(&H::startGeoMetadata) || overrides(&H::endGeoMetadata))
+        mask.addNode(ID::GeoMetadata);
+    if (overrides(&H::startGeoOrigin) || overrides(&H::endGeoOrigin))
+        mask.addNode(ID::GeoOrigin);
+    if (overrides(&H::startGeoPositionInterpolator) || overrides(&H::endGeoPositionInterpolator))
+        mask.addNode(ID::GeoPositionInterpolator);
+    if (overrides(&H::startGeoTouchSensor) || overrides(&H::endGeoTouchSensor))
+        mask.addNode(ID::GeoTouchSensor);
+    if (overrides(&H::startGeoViewpoint) || overrides(&H::endGeoViewpoint))
+        mask.addNode(ID::GeoViewpoint);
+    if (overrides(&H::startHAnimDisplacer) || overrides(&H::endHAnimDisplacer))
+        mask.addNode(ID::HAnimDisplacer);
+    if (overrides(&H::startHAnimHumanoid) || overrides(&H::endHAnimHumanoid))
+        mask.addNode(ID::HAnimHumanoid);
+    if (overrides(&H::startHAnimJoint) || overrides(&H::endHAnimJoint))
+        mask.addNode(ID::HAnimJoint);
+    if (overrides(&H::startHAnimSegment) || overrides(&H::endHAnimSegment))
+        mask.addNode(ID::HAnimSegment);
+    if (overrides(&H::startHAnimSite) || overrides(&H::endHAnimSite))
+        mask.addNode(ID::HAnimSite);
+    if (overrides(&H::startIMPORT) || overrides(&H::endIMPORT))
+        mask.addNode(ID::IMPORT);
+    if (overrides(&H::startIS) || overrides(&H::endIS))
+        mask.addNode(ID::IS);
+    if (overrides(&H::startInline) || overrides(&H::endInline))
+        mask.addNode(ID::Inline);
+    if (overrides(&H::startIntegerSequencer) || overrides(&H::endIntegerSequencer))
+        mask.addNode(ID::IntegerSequencer);
+    if (overrides(&H::startIntegerTrigger) || overrides(&H::endIntegerTrigger))
+        mask.addNode(ID::IntegerTrigger);
+    if (overrides(&H::startKeySensor) || overrides(&H::endKeySensor))
+        mask.addNode(ID::KeySensor);
+    if (overrides(&H::startLineProperties) || overrides(&H::endLineProperties))
+        mask.addNode(ID::LineProperties);
+    if (overrides(&H::startLineSet) || overrides(&H::endLineSet))
+        mask.addNode(ID::LineSet);
+    if (overrides(&H::startLoadSensor) || overrides(&H::endLoadSensor))
+        mask.addNode(ID::LoadSensor);
+    if (overrides(&H::startMetadataDouble) || overrides(&H::endMetadataDouble))
+        mask.addNode(ID::MetadataDouble);
+    if (overrides(&H::startMetadataFloat) || overrides(&H::endMetadataFloat))
+        mask.addNode(ID::MetadataFloat);
+    if (overrides(&H::startMetadataInteger) || overrides(&H::endMetadataInteger))
+        mask.addNode(ID::MetadataInteger);
+    if (overrides(&H::startMetadataSet) || overrides(&H::endMetadataSet))
+        mask.addNode(ID::MetadataSet);
+    if (overrides(&H::startMetadataString) || overrides(&H::endMetadataString))
+        mask.addNode(ID::MetadataString);
+    if (overrides(&H::startMovieTexture) || overrides(&H::endMovieTexture))
+        mask.addNode(ID::MovieTexture);
+    if (overrides(&H::startNavigationInfo) || overrides(&H::endNavigationInfo))
+        mask.addNode(ID::NavigationInfo);
+    if (overrides(&H::startNormalInterpolator) || overrides(&H::endNormalInterpolator))
+        mask.addNode(ID::NormalInterpolator);
+    if (overrides(&H::startNurbsCurve) || overrides(&H::endNurbsCurve))
+        mask.addNode(ID::NurbsCurve);
+    if (overrides(&H::startNurbsCurve2D) || overrides(&H::endNurbsCurve2D))
+        mask.addNode(ID::NurbsCurve2D);
+    if (overrides(&H::startNurbsOrientationInterpolator) || overrides(&H::endNurbsOrientationInterpolator))
+        mask.addNode(ID::NurbsOrientationInterpolator);
+    if (overrides(&H::startNurbsPatchSurface) || overrides(&H::endNurbsPatchSurface))
+        mask.addNode(ID::NurbsPatchSurface);
+    if (overrides(&H::startNurbsPositionInterpolator) || overrides(&H::endNurbsPositionInterpolator))
+        mask.addNode(ID::NurbsPositionInterpolator);
+    if (overrides(&H::startNurbsSet) || overrides(&H::endNurbsSet))
+        mask.addNode(ID::NurbsSet);
+    if (overrides(&H::startNurbsSurfaceInterpolator) || overrides(&H::endNurbsSurfaceInterpolator))
+        mask.addNode(ID::NurbsSurfaceInterpolator);
+    if (overrides(&H::startNurbsSweptSurface) || overrides(&H::endNurbsSweptSurface))
+        mask.addNode(ID::NurbsSweptSurface);
+    if (overrides(&H::startNurbsSwungSurface) || overrides(&H::endNurbsSwungSurface))
+        mask.addNode(ID::NurbsSwungSurface);
+    if (overrides(&H::startNurbsTextureCoordinate) || overrides(&H::endNurbsTextureCoordinate))
+        mask.addNode(ID::NurbsTextureCoordinate);
+    if (overrides(&H::startNurbsTrimmedSurface) || overrides(&H::endNurbsTrimmedSurface))
+        mask.addNode(ID::NurbsTrimmedSurface);
+    if (overrides(&H::startOrientationInterpolator) || overrides(&H::endOrientationInterpolator))
+        mask.addNode(ID::OrientationInterpolator);
+    if (overrides(&H::startPixelTexture) || overrides(&H::endPixelTexture))
+        mask.addNode(ID::PixelTexture);
+    if (overrides(&H::startPlaneSensor) || overrides(&H::endPlaneSensor))
+        mask.addNode(ID::PlaneSensor);
+    if (overrides(&H::startPointLight) || overrides(&H::endPointLight))
+        mask.addNode(ID::PointLight);
+    if (overrides(&H::startPolyline2D) || overrides(&H::endPolyline2D))
+        mask.addNode(ID::Polyline2D);
+    if (overrides(&H::startPolypoint2D) || overrides(&H::endPolypoint2D))
+        mask.addNode(ID::Polypoint2D);
+    if (overrides(&H::startPositionInterpolator) || overrides(&H::endPositionInterpolator))
+        mask.addNode(ID::PositionInterpolator);
+    if (overrides(&H::startPositionInterpolator2D) || overrides(&H::endPositionInterpolator2D))
+        mask.addNode(ID::PositionInterpolator2D);
+    if (overrides(&H::startProtoBody) || overrides(&H::endProtoBody))
+        mask.addNode(ID::ProtoBody);
+    if (overrides(&H::startProtoDeclare) || overrides(&H::endProtoDeclare))
+        mask.addNode(ID::ProtoDeclare);
+    if (overrides(&H::startProtoInterface) || overrides(&H::endProtoInterface))
+        mask.addNode(ID::ProtoInterface);
+    if (overrides(&H::startProximitySensor) || overrides(&H::endProximitySensor))
+        mask.addNode(ID::ProximitySensor);
+    if (overrides(&H::startReceiverPdu) || overrides(&H::endReceiverPdu))
+        mask.addNode(ID::ReceiverPdu);
+    if (overrides(&H::startRectangle2D) || overrides(&H::endRectangle2D))
+        mask.addNode(ID::Rectangle2D);
+    if (overrides(&H::startScalarInterpolator) || overrides(&H::endScalarInterpolator))
+        mask.addNode(ID::ScalarInterpolator);
+    if (overrides(&H::startScene) || overrides(&H::endScene))
+        mask.addNode(ID::Scene);
+    if (overrides(&H::startSignalPdu) || overrides(&H::endSignalPdu))
+        mask.addNode(ID::SignalPdu);
+    if (overrides(&H::startSound) || overrides(&H::endSound))
+        mask.addNode(ID::Sound);
+    if (overrides(&H::startSphereSensor) || overrides(&H::endSphereSensor))
+        mask.addNode(ID::SphereSensor);
+    if (overrides(&H::startSpotLight) || overrides(&H::endSpotLight))
+        mask.addNode(ID::SpotLight);
+    if (overrides(&H::startStringSensor) || overrides(&H::endStringSensor))
+        mask.addNode(ID::StringSensor);
+    if (overrides(&H::startText) || overrides(&H::endText))
+        mask.addNode(ID::Text);
+    if (overrides(&H::startTextureBackground) || overrides(&H::endTextureBackground))
+        mask.addNode(ID::TextureBackground);
+    if (overrides(&H::startTextureCoordinateGenerator) || overrides(&H::endTextureCoordinateGenerator))
+        mask.addNode(ID::TextureCoordinateGenerator);
+    if (overrides(&H::startTimeSensor) || overrides(&H::endTimeSensor))
+        mask.addNode(ID::TimeSensor);
+    if (overrides(&H::startTimeTrigger) || overrides(&H::endTimeTrigger))
+        mask.addNode(ID::TimeTrigger);
+    if (overrides(&H::startTouchSensor) || overrides(&H::endTouchSensor))
+        mask.addNode(ID::TouchSensor);
+    if (overrides(&H::startTransmitterPdu) || overrides(&H::endTransmitterPdu))
+        mask.addNode(ID::TransmitterPdu);
+    if (overrides(&H::startTriangleFanSet) || overrides(&H::endTriangleFanSet))
+        mask.addNode(ID::TriangleFanSet);
+    if (overrides(&H::startTriangleSet) || overrides(&H::endTriangleSet))
+        mask.addNode(ID::TriangleSet);
+    if (overrides(&H::startTriangleSet2D) || overrides(&H::endTriangleSet2D))
+        mask.addNode(ID::TriangleSet2D);
+    if (overrides(&H::startTriangleStripSet) || overrides(&H::endTriangleStripSet))
+        mask.addNode(ID::TriangleStripSet);
+    if (overrides(&H::startViewpoint) || overrides(&H::endViewpoint))
+        mask.addNode(ID::Viewpoint);
+    if (overrides(&H::startVisibilitySensor) || overrides(&H::endVisibilitySensor))
+        mask.addNode(ID::VisibilitySensor);
+    if (overrides(&H::startWorldInfo) || overrides(&H::endWorldInfo))
+        mask.addNode(ID::WorldInfo);
+    if (overrides(&H::startX3D) || overrides(&H::endX3D))
+        mask.addNode(ID::X3D);
+    if (overrides(&H::startcomponent) || overrides(&H::endcomponent))
+        mask.addNode(ID::component);
+    if (overrides(&H::startconnect) || overrides(&H::endconnect))
+        mask.addNode(ID::connect);
+    if (overrides(&H::startfield) || overrides(&H::endfield))
+        mask.addNode(ID::field);
+    if (overrides(&H::starthead) || overrides(&H::endhead))
+        mask.addNode(ID::head);
+    if (overrides(&H::starthumanoidBodyType) || overrides(&H::endhumanoidBodyType))
+        mask.addNode(ID::humanoidBodyType);
+    if (overrides(&H::startmeta) || overrides(&H::endmeta))
+        mask.addNode(ID::meta);
+    if (overrides(&H::startCADAssembly) || overrides(&H::endCADAssembly))
+        mask.addNode(ID::CADAssembly);
+    if (overrides(&H::startCADFace) || overrides(&H::endCADFace))
+        mask.addNode(ID::CADFace);
+    if (overrides(&H::startCADLayer) || overrides(&H::endCADLayer))
+        mask.addNode(ID::CADLayer);
+    if (overrides(&H::startCADPart) || overrides(&H::endCADPart))
+        mask.addNode(ID::CADPart);
+    if (overrides(&H::startComposedCubeMapTexture) || overrides(&H::endComposedCubeMapTexture))
+        mask.addNode(ID::ComposedCubeMapTexture);
+    if (overrides(&H::startComposedShader) || overrides(&H::endComposedShader))
+        mask.addNode(ID::ComposedShader);
+    if (overrides(&H::startComposedTexture3D) || overrides(&H::endComposedTexture3D))
+        mask.addNode(ID::ComposedTexture3D);
+    if (overrides(&H::startFloatVertexAttribute) || overrides(&H::endFloatVertexAttribute))
+        mask.addNode(ID::FloatVertexAttribute);
+    if (overrides(&H::startFogCoordinate) || overrides(&H::endFogCoordinate))
+        mask.addNode(ID::FogCoordinate);
+    if (overrides(&H::startGeneratedCubeMapTexture) || overrides(&H::endGeneratedCubeMapTexture))
+        mask.addNode(ID::GeneratedCubeMapTexture);
+    if (overrides(&H::startImageCubeMapTexture) || overrides(&H::endImageCubeMapTexture))
+        mask.addNode(ID::ImageCubeMapTexture);
+    if (overrides(&H::startImageTexture3D) || overrides(&H::endImageTexture3D))
+        mask.addNode(ID::ImageTexture3D);
+    if (overrides(&H::startIndexedQuadSet) || overrides(&H::endIndexedQuadSet))
+        mask.addNode(ID::IndexedQuadSet);
+    if (overrides(&H::startLocalFog) || overrides(&H::endLocalFog))
+        mask.addNode(ID::LocalFog);
+    if (overrides(&H::startMatrix3VertexAttribute) || overrides(&H::endMatrix3VertexAttribute))
+        mask.addNode(ID::Matrix3VertexAttribute);
+    if (overrides(&H::startMatrix4VertexAttribute) || overrides(&H::endMatrix4VertexAttribute))
+        mask.addNode(ID::Matrix4VertexAttribute);
+    if (overrides(&H::startPackagedShader) || overrides(&H::endPackagedShader))
+        mask.addNode(ID::PackagedShader);
+    if (overrides(&H::startPixelTexture3D) || overrides(&H::endPixelTexture3D))
+        mask.addNode(ID::PixelTexture3D);
+    if (overrides(&H::startProgramShader) || overrides(&H::endProgramShader))
+        mask.addNode(ID::ProgramShader);
+    if (overrides(&H::startQuadSet) || overrides(&H::endQuadSet))
+        mask.addNode(ID::QuadSet);
+    if (overrides(&H::startShaderPart) || overrides(&H::endShaderPart))
+        mask.addNode(ID::ShaderPart);
+    if (overrides(&H::startShaderProgram) || overrides(&H::endShaderProgram))
+        mask.addNode(ID::ShaderProgram);
+    if (overrides(&H::startTextureCoordinate3D) || overrides(&H::endTextureCoordinate3D))
+        mask.addNode(ID::TextureCoordinate3D);
+    if (overrides(&H::startTextureCoordinate4D) || overrides(&H::endTextureCoordinate4D))
+        mask.addNode(ID::TextureCoordinate4D);
+    if (overrides(&H::startTextureTransform3D) || overrides(&H::endTextureTransform3D))
+        mask.addNode(ID::TextureTransform3D);
+    if (overrides(&H::startTextureTransformMatrix3D) || overrides(&H::endTextureTransformMatrix3D))
+        mask.addNode(ID::TextureTransformMatrix3D);
+    // END GENERATED
+    return mask;
+}
+
+}  // namespace XIOT
+
+#endif
@@ -205,6 +205,7 @@ namespace XIOT {
 
 // forward declarations
 class X3DNodeHandler;
+class X3DInterestMask;
 
 /**
  * Interface for all X3D loader implementations.
@@ -240,6 +241,12 @@ class XIOT_EXPORT X3DLoader {
    */
     bool load(const char *fileName, bool fileValidation = false) const;
 
+    /**
+   * Returns true, if a callback of the last load() returned ABORT. The
+   * loader stopped reading the file then and called endDocument().
+   */
+    bool wasAborted() const { return _aborted; };
+
     /**
    * Sets the X3DNodeHandler which processes the callbacks. If there is already
    * a handler, it will be replaced. 
@@ -250,9 +257,22 @@ class XIOT_EXPORT X3DLoader {
    */
     void setNodeHandler(X3DNodeHandler *handler);
 
+    /**
+   * Restricts the callbacks to the nodes in the mask. For the other nodes
+   * no X3DAttributes are created. If NULL (default), all nodes are reported.
+   * @warning The loader will not copy or delete the mask.
+   * @see X3DInterestMask
+   */
+    void setInterestMask(const X3DInterestMask *mask) { _interestMask = mask; };
+    const X3DInterestMask *getInterestMask() const { return _interestMask; };
+
   protected:
     /// Handler.
     X3DNodeHandler *_handler;
+    /// Nodes of interest or NULL for all nodes.
+    const X3DInterestMask *_interestMask;
+    /// Set by load() if a callback returned ABORT
+    mutable bool _aborted;
 };
 
 }  // namespace XIOT
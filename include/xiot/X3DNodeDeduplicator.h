@@ -0,0 +1,151 @@
+/*=========================================================================
+     This file is part of the XIOT library.
+
+     Copyright (C) 2008-2009 EDF R&D
+     Author: Kristian Sons (xiot@actor3d.com)
+
+     This library is free software; you can redistribute it and/or modify
+     it under the terms of the GNU Lesser Public License as published by
+     the Free Software Foundation; either version 2.1 of the License, or
+     (at your option) any later version.
+
+     The XIOT library is distributed in the hope that it will be useful,
+     but WITHOUT ANY WARRANTY; without even the implied warranty of
+     MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+     GNU Lesser Public License for more details.
+
+     You should have received a copy of the GNU Lesser Public License
+     along with XIOT; if not, write to the Free Software
+     Foundation, Inc., 51 Franklin St, Fifth Floor, Boston,
+     MA 02110-1301  USA
+=========================================================================*/
+#ifndef X3D_X3DNODEDEDUPLICATOR_H
+#define X3D_X3DNODEDEDUPLICATOR_H
+
+#include <deque>
+#include <map>
+#include <set>
+#include <string>
+#include <vector>
+#include <xiot/XIOTConfig.h>
+
+namespace XIOT {
+
+class X3DWriter;
+struct RecordedCall;
+
+/**
+ * Statistics of the nodes a X3DWriter replaced by a USE.
+ */
+struct XIOT_EXPORT DeduplicationStatistics {
+    DeduplicationStatistics() : nodes(0), arrays(0), octets(0){};
+
+    /// The number of nodes written as USE of an earlier node
+    size_t nodes;
+    /// The number of int and float arrays that were not encoded, i.e. the
+    /// calls of the compressing algorithms that were avoided
+    size_t arrays;
+    /// The size of the array values that were not written in octets, before
+    /// compression
+    size_t octets;
+};
+
+/**
+ * Replaces repeated geometry and array nodes of a X3DWriter by a USE.
+ *
+ * The writer passes its calls to the deduplicator first. The calls for
+ * a geometry node (IndexedFaceSet, PointSet, ...) or an array node
+ * (Coordinate, Normal, Color, ColorRGBA, TextureCoordinate) and their
+ * children are recorded and hashed. At the end of the node, the calls are
+ * written to the writer again. A node with as many array octets as the
+ * minimum size whose content was written before is written as USE of the
+ * earlier node, otherwise it gets a generated DEF.
+ *
+ * Only nodes without a DEF in their subtree are replaced or used, as a
+ * node with a DEF may be the target of a ROUTE that must not reach the
+ * other uses. Nodes are compared by two independent 64 bit hashes and the
+ * size of their fields.
+ *
+ * The generated names _xiot0, _xiot1, ... skip the DEF values written
+ * before, DEF values written later must not use them.
+ *
+ * @see Property::ArrayDeduplication
+ * @ingroup x3dloader
+ */
+class XIOT_EXPORT X3DNodeDeduplicator {
+  public:
+    enum FieldType {
+        SFFloat,
+        SFInt32,
+        SFBool,
+        SFVec3f,
+        SFVec2f,
+        SFRotation,
+        SFString,
+        SFColor,
+        SFImage,
+        MFBool,
+        MFFloat,
+        MFInt32,
+        MFVec3f,
+        MFVec2f,
+        MFRotation,
+        MFString,
+        MFColor
+    };
+
+    X3DNodeDeduplicator(X3DWriter &writer);
+    ~X3DNodeDeduplicator();
+
+    /// 0 switches the deduplication off
+    void setMinimumSize(size_t octets);
+    size_t getMinimumSize() const { return _minimumSize; };
+    const DeduplicationStatistics &getStatistics() const { return _statistics; };
+
+    /// Forgets the written nodes and names, for a new document
+    void reset();
+
+    // The calls of the writer, they return true if the call was recorded
+    // and must not be written
+    bool startNode(int nodeID);
+    bool endNode();
+    bool setFloats(FieldType type, int attributeID, const float *values, size_t size);
+    bool setInts(FieldType type, int attributeID, const int *values, size_t size);
+    bool setBools(int attributeID, const std::vector<bool> &values);
+    bool setStrings(FieldType type, int attributeID, const std::string *values, size_t size);
+
+  private:
+    /// The content of a written node that later nodes can USE
+    struct Content {
+        unsigned long long hash;
+        unsigned long long check;
+        size_t size;
+
+        bool operator<(const Content &other) const;
+    };
+
+    /// Adds the last call to the content of the open nodes
+    void record();
+    void write(size_t begin, size_t end);
+    void writeCall(const RecordedCall &call);
+    /// Returns the next generated name that is not a DEF value yet
+    std::string createName();
+
+    X3DWriter &_writer;
+    size_t _minimumSize;
+    bool _isWriting;
+    size_t _nextName;
+    DeduplicationStatistics _statistics;
+    // A deque does not copy the recorded arrays when it grows
+    std::deque<RecordedCall> *_calls;
+    /// The indices of the recorded nodes that are not ended
+    std::vector<size_t> _openNodes;
+    /// The names of the written nodes by their content
+    std::map<Content, std::string> _names;
+    /// The DEF values written so far
+    std::set<std::string> _definedNames;
+};
+
+}  // namespace XIOT
+
+#endif
@@ -0,0 +1,103 @@
+/*=========================================================================
+     This file is part of the XIOT library.
+
+     Copyright (C) 2008-2009 EDF R&D
+     Author: Kristian Sons (xiot@actor3d.com)
+
+     This library is free software; you can redistribute it and/or modify
+     it under the terms of the GNU Lesser Public License as published by
+     the Free Software Foundation; either version 2.1 of the License, or
+     (at your option) any later version.
+
+     The XIOT library is distributed in the hope that it will be useful,
+     but WITHOUT ANY WARRANTY; without even the implied warranty of
+     MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+     GNU Lesser Public License for more details.
+
+     You should have received a copy of the GNU Lesser Public License
+     along with XIOT; if not, write to the Free Software
+     Foundation, Inc., 51 Franklin St, Fifth Floor, Boston,
+     MA 02110-1301  USA
+=========================================================================*/
+#ifndef X3D_X3DOUTPUTSINK_H
+#define X3D_X3DOUTPUTSINK_H
+
+#include <ostream>
+#include <vector>
+#include <xiot/XIOTConfig.h>
+
+namespace XIOT {
+
+/**
+ * Receives the encoded document of a X3DWriter.
+ *
+ * The writers collect their output in a buffer and pass it to the sink in
+ * large blocks, directly from that buffer. An application implements
+ * write() to hand the blocks to its transport layer:
+ * \code
+class SocketSink : public XIOT::X3DOutputSink {
+  public:
+    virtual void write(const char *data, size_t size) { send(_socket, data, size, 0); }
+    int _socket;
+};
+
+SocketSink sink;
+writer->openSink(&sink);
+   \endcode
+ *
+ * @see X3DWriter::openSink()
+ * @ingroup x3dloader
+ */
+class XIOT_EXPORT X3DOutputSink {
+  public:
+    virtual ~X3DOutputSink(){};
+
+    /// The data is only valid during the call.
+    virtual void write(const char *data, size_t size) = 0;
+    /// Called by X3DWriter::flush() and X3DWriter::closeFile()
+    virtual void flush(){};
+};
+
+/**
+ * Collects the document in a growing memory buffer.
+ *
+ * @ingroup x3dloader
+ */
+class XIOT_EXPORT X3DMemorySink : public X3DOutputSink {
+  public:
+    virtual void write(const char *data, size_t size);
+
+    /// NULL if nothing was written
+    const char *getData() const { return _buffer.empty() ? NULL : &_buffer.front(); };
+    size_t getSize() const { return _buffer.size(); };
+
+    /// Avoids the reallocations if the size of the document is known
+    void reserve(size_t size);
+    void clear();
+    /// Exchanges the document with the content of the vector, it is handed
+    /// over without a copy
+    void swap(std::vector<char> &buffer);
+
+  private:
+    std::vector<char> _buffer;
+};
+
+/**
+ * Writes the document to a std::ostream.
+ *
+ * @ingroup x3dloader
+ */
+class XIOT_EXPORT X3DStreamSink : public X3DOutputSink {
+  public:
+    X3DStreamSink(std::ostream &stream) : _stream(stream){};
+
+    virtual void write(const char *data, size_t size);
+    virtual void flush();
+
+  private:
+    std::ostream &_stream;
+};
+
+}  // namespace XIOT
+
+#endif
@@ -37,7 +37,7 @@ namespace XIOT {
  * in the X3DB spec.
  *
  * This includes the tables for element and attribute names, for 
- * attribute values and two X3D specific encoding algorithms
+ * attribute values and the encoding algorithms of the X3DFICodecRegistry
  *
  * @link(http://www.web3d.org/x3d/specifications/ISO-IEC-FCD-19776-3.2-X3DEncodings-CompressedBinary/Part03/tables.html)
  *
@@ -51,8 +51,10 @@ class XIOT_EXPORT X3DParserVocabulary : public FI::DefaultParserVocabulary {
     X3DParserVocabulary();
     virtual ~X3DParserVocabulary(){};
 
-    QuantizedzlibFloatArrayAlgorithm _quantizedzlibFloatArrayAlgorithm;
-    DeltazlibIntArrayAlgorithm _deltazlibIntArrayAlgorithm;
+    /// @deprecated The algorithms of the X3DFICodecRegistry, use
+    /// X3DFICodecRegistry::findByID() instead.
+    QuantizedzlibFloatArrayAlgorithm &_quantizedzlibFloatArrayAlgorithm;
+    DeltazlibIntArrayAlgorithm &_deltazlibIntArrayAlgorithm;
 
   private:
 };
@@ -41,8 +41,9 @@ namespace XIOT {
 static const int CONTINUE = 1;
 /**
    * Return value for element callbacks that indicates
-   * the parser should abort.
-   * @warning Not implemented yet.
+   * the parser should abort. The loader stops reading
+   * the file, calls endDocument() and returns true.
+   * @see X3DLoader::wasAborted()
    */
 static const int ABORT = 2;
 /**
@@ -55,12 +56,33 @@ static const int SKIP_CHILDREN = 3;
 struct XIOT_EXPORT Property {
     static const char *FloatEncodingAlgorithm;  // "http://www.web3d.org/x3d/properties/fi/FloatEncodingAlgorithm";
     static const char *IntEncodingAlgorithm;    // "http://www.web3d.org/x3d/properties/fi/IntEncodingAlgorithm";
+    static const char *FloatQuantization;       // "http://www.web3d.org/x3d/properties/fi/FloatQuantization";
+    static const char *ParallelCompression;     // "http://www.web3d.org/x3d/properties/fi/ParallelCompression";
+    static const char *MeshCompression;         // "http://www.web3d.org/x3d/properties/fi/MeshCompression";
+    /// bool *, single value float and int fields are encoded with the FI built-in
+    /// algorithms instead of text. Off by default, Xj3D expects text
+    static const char *BinarySingleFields;  // "http://www.web3d.org/x3d/properties/fi/BinarySingleFields";
+    /// size_t *, the maximum size of the attribute value table in octets. 0, the default,
+    /// writes all values as literals. 4194304 is enough for the names and URLs of large scenes
+    static const char *AttributeValueTableLimit;  // "http://www.web3d.org/x3d/properties/fi/AttributeValueTableLimit";
+    /// FI::StringTableStatistics *, read only
+    static const char *AttributeValueTableStatistics;  // "http://www.web3d.org/x3d/properties/fi/AttributeValueTableStatistics";
+    /// size_t *, geometry and array nodes with at least this many octets of arrays are
+    /// written as USE if they were written before, 0 switches it off. FI and XML writer
+    static const char *ArrayDeduplication;  // "http://www.web3d.org/x3d/properties/ArrayDeduplication";
+    /// DeduplicationStatistics *, read only
+    static const char *ArrayDeduplicationStatistics;  // "http://www.web3d.org/x3d/properties/ArrayDeduplicationStatistics";
 };
 
 struct XIOT_EXPORT Encoder {
     static const char *BuiltIn;                         // 0;
     static const char *DeltazlibIntArrayEncoder;        // "encoder://web3d.org/DeltazlibIntArrayEncoder";
     static const char *QuantizedzlibFloatArrayEncoder;  // "encoder://web3d.org/QuantizedzlibFloatArrayEncoder";
+    static const char *BlockzlibArrayEncoder;           // "encoder://xiot/BlockzlibArrayEncoder";
+    static const char *ShufflezlibFloatArrayEncoder;    // "encoder://xiot/ShufflezlibFloatArrayEncoder";
+    static const char *MeshIndexEncoder;                // "encoder://xiot/MeshIndexEncoder";
+    static const char *MeshCoordinateEncoder;           // "encoder://xiot/MeshCoordinateEncoder";
+    static const char *VarintzlibIntArrayEncoder;       // "encoder://xiot/VarintzlibIntArrayEncoder";
 };
 
 enum X3DProfile {
@@ -83,6 +105,7 @@ enum X3DVersion {
    * \defgroup x3ddatatypes X3D Data Types
    */
 
+typedef std::vector<bool> MFBool;
 typedef std::vector<float> MFFloat;
 typedef std::vector<int> MFInt32;
 
@@ -232,27 +255,31 @@ typedef std::vector<SFImage> MFImage;
    *
    * The X3DTypes class provides static functions for obtaining an 
    * attribute's or element's string representation by its ID 
-   * or vice versa.
+   * or vice versa. The names are looked up in constant tables
+   * generated by the sourceGenerator, so the functions are thread-safe.
    */
 class XIOT_EXPORT X3DTypes {
-    friend class X3DParserVocabulary;
-
   public:
+    /// Returns the name of the element or an empty string for an unknown id.
     static const char *getElementByID(int id);
+    /// Returns the name of the attribute or an empty string for an unknown id.
     static const char *getAttributeByID(int id);
+
+    /// Returns the id of the element with the name of the given length or -1.
+    static int getElementID(const char *elementStr, size_t length);
+    static int getElementID(const char *elementStr);
     static int getElementID(const std::string &elementStr);
+
+    /// Returns the id of the attribute with the name of the given length or -1.
+    static int getAttributeID(const char *attributeStr, size_t length);
+    static int getAttributeID(const char *attributeStr);
     static int getAttributeID(const std::string &attributeStr);
 
+    /// Does nothing, the name tables are initialized at compile time.
     static void initMaps();
 
     static const char *getProfileString(X3DProfile profile);
     static const char *getVersionString(X3DVersion version);
-
-  private:
-    static std::map<std::string, int> elementFromStringMap;
-    static std::map<std::string, int> attributeFromStringMap;
-    static std::map<int, std::string> elementFromIDMap;
-    static std::map<int, std::string> attributeFromIDMap;
 };
 
 
@@ -33,17 +33,28 @@
 
 namespace XIOT {
 
+class X3DOutputSink;
+
 enum X3DWriterType { X3DXML,
                      X3DVRML,
                      X3DFI };
 
 class XIOT_EXPORT X3DWriter {
   public:
+    virtual ~X3DWriter() {}
+
     // Description:
     // Opens the file specified with file
     // returns 1 if sucessfull otherwise 0
     virtual int openFile(const char *file) = 0;
-    // Closes the file if open
+    // Description:
+    // Writes to the stream or sink instead of a file, the caller keeps
+    // the ownership. They have to exist until closeFile() is called.
+    // returns 1 if sucessfull otherwise 0
+    virtual int openStream(std::ostream &) { return 0; };
+    virtual int openSink(X3DOutputSink *) { return 0; };
+    // Closes the file if open, for a stream or sink the remaining
+    // output is written and flushed
     virtual void closeFile() = 0;
     // Flush can be called optionally after some operations to
     // flush the buffer to the filestream. A writer not necessarily
@@ -96,6 +107,7 @@ class XIOT_EXPORT X3DWriter {
     virtual void setSFImage(int attributeID, const std::vector<int> &) = 0;
 
     // Multi Field
+    virtual void setMFBool(int attributeID, const std::vector<bool> &) = 0;
     virtual void setMFFloat(int attributeID, const std::vector<float> &) = 0;
     virtual void setMFInt32(int attributeID, const std::vector<int> &) = 0;
 
@@ -28,12 +28,15 @@
 namespace XIOT {
 
 class X3DWriterFIByte;
+class X3DNodeDeduplicator;
 struct NodeInfo;
 
 class XIOT_EXPORT X3DWriterFI : public X3DWriter {
   public:
     virtual void closeFile();
     virtual int openFile(const char *file);
+    virtual int openStream(std::ostream &stream);
+    virtual int openSink(X3DOutputSink *sink);
 
     virtual void flush();
 
@@ -57,6 +60,7 @@ class XIOT_EXPORT X3DWriterFI : public X3DWriter {
     virtual void setSFImage(int attributeID, const std::vector<int> &);
 
     // Multi Field
+    virtual void setMFBool(int attributeID, const std::vector<bool> &);
     virtual void setMFFloat(int attributeID, const std::vector<float> &);
     virtual void setMFInt32(int attributeID, const std::vector<int> &);
 
@@ -74,16 +78,32 @@ class XIOT_EXPORT X3DWriterFI : public X3DWriter {
 
 
   private:
+    int open(std::ostream &stream);
     void startAttribute(int attributeID, bool literal, bool addToTable = false);
+    void encodeAttributeName(int attributeID);
+    /// Writes the value as index if it is in the attribute value table
+    void setAttributeValue(int attributeID, const std::string &value, bool addToTable);
+    /// stride is the number of floats per field value
+    void setFloatArray(int attributeID, const std::vector<float> &values, unsigned int stride);
+    /// Writes the values of a single field as text or with the built-in algorithm
+    void setSingleFloats(int attributeID, const float *values, size_t size);
     void endAttribute();
 
     void checkNode(bool callerIsAttribute = true);
 
     std::vector<NodeInfo> *_infoStack;
+    X3DNodeDeduplicator *_deduplicator;
     X3DFIEncoder _encoder;
     int _fastest;
     std::ofstream _stream;
+    /// The file, the stream of the caller or the stream writing to a sink
+    std::ostream *_output;
+    std::streambuf *_sinkBuffer;
+    std::ostream *_sinkStream;
     bool _isLineFeedEncodingOn;
+    bool _binarySingleFields;
+    size_t _attributeValueTableLimit;
+    size_t _arrayDeduplication;
 };
 
 }  // namespace XIOT
@@ -26,6 +26,9 @@
 
 namespace XIOT {
 
+class X3DNodeDeduplicator;
+class X3DOutputSink;
+
 struct XMLInfo {
 
     XMLInfo(int _elementId) {
@@ -41,6 +44,8 @@ class XIOT_EXPORT X3DWriterXML : public X3DWriter {
   public:
     virtual void closeFile();
     virtual int openFile(const char *file);
+    virtual int openStream(std::ostream &stream);
+    virtual int openSink(X3DOutputSink *sink);
     virtual void flush();
 
 
@@ -65,6 +70,7 @@ class XIOT_EXPORT X3DWriterXML : public X3DWriter {
     virtual void setSFImage(int attributeID, const std::vector<int> &);
 
     // Multi Field
+    virtual void setMFBool(int attributeID, const std::vector<bool> &);
     virtual void setMFFloat(int attributeID, const std::vector<float> &);
     virtual void setMFInt32(int attributeID, const std::vector<int> &);
 
@@ -86,11 +92,20 @@ class XIOT_EXPORT X3DWriterXML : public X3DWriter {
     void addDepth();
     void subDepth();
     void printAttributeString(int attributeID);
+    void print(const char *format, ...);
+    void write(const char *data, size_t size);
+    void flushBuffer();
 
     std::string ActTab;
     int Depth;
-    FILE *OutputStream;
+    X3DOutputSink *OutputSink;
+    // The sink for a file or stream opened by the writer
+    X3DOutputSink *OwnedSink;
+    std::vector<char> Buffer;
+    size_t BufferPos;
     std::vector<XMLInfo> *InfoStack;
+    X3DNodeDeduplicator *Deduplicator;
+    size_t ArrayDeduplication;
 };
 
 }  // namespace XIOT
@@ -74,6 +74,7 @@ class XIOT_EXPORT X3DXMLAttributes : public X3DAttributes {
     virtual void getSFImage(int index, SFImage &value) const;
 
     // Multi Field
+    virtual void getMFBool(int index, MFBool &value) const;
     virtual void getMFFloat(int index, MFFloat &value) const;
     virtual void getMFInt32(int index, MFInt32 &value) const;
     virtual void getMFVec3f(int index, MFVec3f &value) const;
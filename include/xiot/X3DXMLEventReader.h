@@ -0,0 +1,67 @@
+/*=========================================================================
+     This file is part of the XIOT library.
+
+     Copyright (C) 2008-2009 EDF R&D
+     Author: Kristian Sons (xiot@actor3d.com)
+
+     This library is free software; you can redistribute it and/or modify
+     it under the terms of the GNU Lesser Public License as published by
+     the Free Software Foundation; either version 2.1 of the License, or
+     (at your option) any later version.
+
+     The XIOT library is distributed in the hope that it will be useful,
+     but WITHOUT ANY WARRANTY; without even the implied warranty of
+     MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+     GNU Lesser Public License for more details.
+
+     You should have received a copy of the GNU Lesser Public License
+     along with XIOT; if not, write to the Free Software
+     Foundation, Inc., 51 Franklin St, Fifth Floor, Boston,
+     MA 02110-1301  USA
+=========================================================================*/
+#ifndef X3D_X3DXMLEVENTREADER_H
+#define X3D_X3DXMLEVENTREADER_H
+
+#include <xiot/X3DEventReader.h>
+
+namespace XIOT {
+
+/**
+ * @class XMLEventReaderImpl
+ * Wrapper to hide the XML parser implementation from the interface.
+ */
+class XMLEventReaderImpl;
+
+/**
+ * Event reader for XML encoded X3D files.
+ *
+ * The XML parser is driven incrementally and suspended after each event,
+ * so only the data needed for the next event is read from the file.
+ * Character data of an element is returned as a single CHARACTERS event,
+ * whitespace between elements is skipped.
+ *
+ * @see X3DEventReader
+ * @see X3DXMLLoader
+ * @ingroup x3dloader
+ */
+class XIOT_EXPORT X3DXMLEventReader : public X3DEventReader {
+  public:
+    /// Constructor.
+    X3DXMLEventReader();
+    /// Destructor.
+    virtual ~X3DXMLEventReader();
+
+    virtual bool open(const char *fileStr);
+    virtual void close();
+    virtual bool hasNext() const;
+    virtual EventType next();
+    virtual const X3DAttributes &getAttributes() const;
+    virtual std::string getCharacters() const;
+
+  protected:
+    XMLEventReaderImpl *_impl;
+};
+
+}  // namespace XIOT
+
+#endif
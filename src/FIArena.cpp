@@ -0,0 +1,53 @@
+#include <xiot/FIArena.h>
+
+namespace FI {
+
+// All allocations are aligned to this
+static const size_t ARENA_ALIGNMENT = 8;
+
+Arena::Arena(size_t blockSize) : _blockSize(blockSize), _current(0), _pos(NULL), _end(NULL), _allocationCount(0), _heapAllocationCount(0) {
+}
+
+Arena::~Arena() {
+    reset();
+    for (std::vector<unsigned char *>::iterator I = _blocks.begin(); I != _blocks.end(); I++)
+        delete[] *I;
+}
+
+void *Arena::allocate(size_t size) {
+    _allocationCount++;
+    size = (size + ARENA_ALIGNMENT - 1) & ~(ARENA_ALIGNMENT - 1);
+
+    // Large chunks get a block of their own
+    if (size > _blockSize / 2) {
+        _heapAllocationCount++;
+        _largeBlocks.push_back(new unsigned char[size]);
+        return _largeBlocks.back();
+    }
+
+    if (size > static_cast<size_t>(_end - _pos)) {
+        if (_pos != NULL)
+            _current++;
+        if (_current == _blocks.size()) {
+            _heapAllocationCount++;
+            _blocks.push_back(new unsigned char[_blockSize]);
+        }
+        _pos = _blocks[_current];
+        _end = _pos + _blockSize;
+    }
+
+    void *result = _pos;
+    _pos += size;
+    return result;
+}
+
+void Arena::reset() {
+    for (std::vector<unsigned char *>::iterator I = _largeBlocks.begin(); I != _largeBlocks.end(); I++)
+        delete[] *I;
+    _largeBlocks.clear();
+
+    _current = 0;
+    _pos = _end = NULL;
+}
+
+}  // namespace FI
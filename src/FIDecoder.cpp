@@ -4,13 +4,86 @@
 #include <xiot/FIParserVocabulary.h>
 #include <xiot/X3DFIAttributes.h>
 
+#include <algorithm>
 #include <cassert>
+#include <cstring>
 #include <iostream>
 #include <sstream>
 
 namespace FI {
 
-Decoder::Decoder() {
+/**
+ * Decoding of the octet that starts an integer (C.25 - C.28) or the length of an
+ * octet string (C.22 - C.24). For every possible value of this octet the table holds
+ * the number of octets following, the mask for the bits of the value inside the
+ * octet itself and the bias to add.
+ */
+struct PrefixEntry {
+    unsigned char _octets;
+    unsigned char _mask;
+    unsigned int _bias;
+};
+
+#define PREFIX_ILLEGAL 0xFF
+
+// Expand an entry macro for all 256 octet values at compile time
+#define PREFIX_ROW(E, b) E(b) E(b + 1) E(b + 2) E(b + 3) E(b + 4) E(b + 5) E(b + 6) E(b + 7) \
+    E(b + 8) E(b + 9) E(b + 10) E(b + 11) E(b + 12) E(b + 13) E(b + 14) E(b + 15)
+#define PREFIX_TABLE(E) PREFIX_ROW(E, 0x00) PREFIX_ROW(E, 0x10) PREFIX_ROW(E, 0x20) PREFIX_ROW(E, 0x30) \
+    PREFIX_ROW(E, 0x40) PREFIX_ROW(E, 0x50) PREFIX_ROW(E, 0x60) PREFIX_ROW(E, 0x70)                   \
+    PREFIX_ROW(E, 0x80) PREFIX_ROW(E, 0x90) PREFIX_ROW(E, 0xA0) PREFIX_ROW(E, 0xB0)                   \
+    PREFIX_ROW(E, 0xC0) PREFIX_ROW(E, 0xD0) PREFIX_ROW(E, 0xE0) PREFIX_ROW(E, 0xF0)
+
+// C.25 & C.26: '0' + 6 bits | '10' + 13 bits | '110' + 20 bits | '1111111' for zero
+#define INTEGER2_ENTRY(b) {                                             \
+    (((b)&0x40) == 0 || ((b)&0x7F) == 0x7F) ? 0 : ((b)&0x60) == 0x40 ? 1 \
+                                              : ((b)&0x70) == 0x60 ? 2   \
+                                                                   : PREFIX_ILLEGAL, \
+    ((b)&0x40) == 0 ? 0x3F : ((b)&0x7F) == 0x7F ? 0 : ((b)&0x60) == 0x40 ? 0x1F : 0x0F, \
+    ((b)&0x40) == 0 ? 1 : ((b)&0x7F) == 0x7F ? 0 : ((b)&0x60) == 0x40 ? 65 : 8257},
+
+// C.27: '0' + 5 bits | '100' + 11 bits | '101' + 19 bits | '1100000000' + 20 bits
+#define INTEGER3_ENTRY(b) {                                                   \
+    ((b)&0x20) == 0 ? 0 : ((b)&0x38) == 0x20 ? 1 : ((b)&0x38) == 0x28 ? 2      \
+                                             : ((b)&0x3F) == 0x30 ? 3         \
+                                                                  : PREFIX_ILLEGAL, \
+    ((b)&0x20) == 0 ? 0x1F : ((b)&0x38) == 0x30 ? 0 : 0x07,                    \
+    ((b)&0x20) == 0 ? 1 : ((b)&0x38) == 0x20 ? 33 : ((b)&0x38) == 0x28 ? 2081 : 526369},
+
+// C.28: '0' + 4 bits | '100' + 10 bits | '101' + 18 bits | '110000000' + 20 bits
+#define INTEGER4_ENTRY(b) {                                                   \
+    ((b)&0x10) == 0 ? 0 : ((b)&0x1C) == 0x10 ? 1 : ((b)&0x1C) == 0x14 ? 2      \
+                                             : ((b)&0x1F) == 0x18 ? 3         \
+                                                                  : PREFIX_ILLEGAL, \
+    ((b)&0x10) == 0 ? 0x0F : ((b)&0x1C) == 0x18 ? 0 : 0x03,                    \
+    ((b)&0x10) == 0 ? 1 : ((b)&0x1C) == 0x10 ? 17 : ((b)&0x1C) == 0x14 ? 1041 : 263185},
+
+// C.22: '0' + 6 bits | '1000000' + 8 bits | '1100000' + 32 bits
+#define LENGTH2_ENTRY(b) {                                                                         \
+    ((b)&0x40) == 0 ? 0 : ((b)&0x7F) == 0x40 ? 1 : ((b)&0x7F) == 0x60 ? 4 : PREFIX_ILLEGAL,        \
+    ((b)&0x40) == 0 ? 0x3F : 0,                                                                     \
+    ((b)&0x40) == 0 ? 1 : ((b)&0x7F) == 0x40 ? 65 : 321},
+
+// C.23: '0' + 3 bits | '1000' + 8 bits | '1100' + 32 bits
+#define LENGTH5_ENTRY(b) {                                                                         \
+    ((b)&0x08) == 0 ? 0 : ((b)&0x0F) == 0x08 ? 1 : ((b)&0x0F) == 0x0C ? 4 : PREFIX_ILLEGAL,        \
+    ((b)&0x08) == 0 ? 0x07 : 0,                                                                     \
+    ((b)&0x08) == 0 ? 1 : ((b)&0x0F) == 0x08 ? 9 : 265},
+
+// C.24: '0' + 1 bit | '10' + 8 bits | '11' + 32 bits
+#define LENGTH7_ENTRY(b) {                                     \
+    ((b)&0x02) == 0 ? 0 : ((b)&0x03) == 0x02 ? 1 : 4,          \
+    ((b)&0x02) == 0 ? 0x01 : 0,                                 \
+    ((b)&0x02) == 0 ? 1 : ((b)&0x03) == 0x02 ? 3 : 259},
+
+static const PrefixEntry INTEGER2_PREFIX[256] = {PREFIX_TABLE(INTEGER2_ENTRY)};
+static const PrefixEntry INTEGER3_PREFIX[256] = {PREFIX_TABLE(INTEGER3_ENTRY)};
+static const PrefixEntry INTEGER4_PREFIX[256] = {PREFIX_TABLE(INTEGER4_ENTRY)};
+static const PrefixEntry LENGTH2_PREFIX[256] = {PREFIX_TABLE(LENGTH2_ENTRY)};
+static const PrefixEntry LENGTH5_PREFIX[256] = {PREFIX_TABLE(LENGTH5_ENTRY)};
+static const PrefixEntry LENGTH7_PREFIX[256] = {PREFIX_TABLE(LENGTH7_ENTRY)};
+
+Decoder::Decoder() : _source(NULL), _streamSource(NULL), _arena(NULL), _pos(NULL), _end(NULL) {
     _vocab = new DefaultParserVocabulary();
 }
 
@@ -19,6 +92,7 @@ Decoder::~Decoder() {
     if (_vocab != NULL) {
         delete _vocab;
     }
+    delete _streamSource;
 }
 
 void Decoder::addExternalVocabularies(const std::string &name, ParserVocabulary *parserVocabulary) {
@@ -27,34 +101,134 @@ void Decoder::addExternalVocabularies(const std::string &name, ParserVocabulary
 
 
 void Decoder::setStream(std::istream *stream) {
-    _stream = stream;
+    if (!_streamSource)
+        _streamSource = new BufferedInputSource();
+    _streamSource->setStream(stream);
+    setInputSource(_streamSource);
+}
+
+void Decoder::setInputSource(InputSource *source) {
+    _source = source;
+    _pos = _end = NULL;
+}
+
+bool Decoder::fillWindow() {
+    while (_source && _source->nextBlock(_pos, _end)) {
+        if (_pos != _end)
+            return true;
+    }
+    _pos = _end = NULL;
+    return false;
+}
+
+bool Decoder::isEndOfInput() {
+    return _pos == _end && !fillWindow();
+}
+
+void Decoder::getOctets(unsigned char *dest, size_t length) {
+    while (length) {
+        if (_pos == _end && !fillWindow())
+            throw std::runtime_error("Unexpected end of input");
+        size_t count = std::min(length, static_cast<size_t>(_end - _pos));
+        memcpy(dest, _pos, count);
+        _pos += count;
+        dest += count;
+        length -= count;
+    }
+}
+
+void Decoder::getOctetString(FI::OctetString &value, size_t length) {
+    if (_source && _source->isContiguous()) {
+        // The window holds all of the remaining input, nothing to copy if it is too short
+        if (static_cast<size_t>(_end - _pos) < length) {
+            _pos = _end;
+            fillWindow();
+            throw std::runtime_error("Unexpected end of input");
+        }
+        value.setView(_pos, length);
+        _pos += length;
+    } else if (_arena) {
+        unsigned char *octets = static_cast<unsigned char *>(_arena->allocate(length));
+        getOctets(octets, length);
+        value.setView(octets, length);
+    } else
+        getOctets(value.allocate(length), length);
+}
+
+void Decoder::skipOctets(size_t length) {
+    size_t count = std::min(length, static_cast<size_t>(_end - _pos));
+    _pos += count;
+    length -= count;
+    if (length && _source)
+        length -= _source->skip(length);
+
+    while (length) {
+        if (!fillWindow())
+            throw std::runtime_error("Unexpected end of input");
+        count = std::min(length, static_cast<size_t>(_end - _pos));
+        _pos += count;
+        length -= count;
+    }
+}
+
+unsigned int Decoder::getPrefixedValue(const PrefixEntry &entry) {
+    unsigned int value = _b & entry._mask;
+    unsigned char buf[3];
+    switch (entry._octets) {
+        case 0:
+            break;
+        case 1:
+            value = (value << 8) | getOctet();
+            break;
+        case 2:
+            getOctets(buf, 2);
+            value = (value << 16) | (buf[0] << 8) | buf[1];
+            break;
+        case 3:
+            // The first four bits are padding
+            getOctets(buf, 3);
+            value = ((buf[0] & Constants::LAST_FOUR_BITS) << 16) | (buf[1] << 8) | buf[2];
+            break;
+        case 4:
+            value = getUInt32();
+            break;
+        default:
+            throw std::runtime_error("Illegal Integer or Octet length encoding");
+    }
+    return value + entry._bias;
+}
+
+unsigned int Decoder::getUInt32() {
+    unsigned char buf[4];
+    getOctets(buf, 4);
+    return (buf[0] << 24) | (buf[1] << 16) | (buf[2] << 8) | buf[3];
 }
 
 
 // C.1
 bool Decoder::detectFIDocument() {
-    _b = static_cast<unsigned char>(_stream->get());
+    _b = getOctet();
     // C.1.3 A fast infoset document may begin either with an XML declaration (see 12.3) followed by:
 
     // a) the sixteen bits '1110000000000000' (identification); followed by
     if (_b != Constants::IDENT1)  // equals 11100000
         return false;
 
-    _b = static_cast<unsigned char>(_stream->get());
+    _b = getOctet();
     if (_b != Constants::IDENT2)  // equals 00000000
         return false;
 
     // b) the sixteen bits '0000000000000001' (version number); followed by
-    _b = static_cast<unsigned char>(_stream->get());
+    _b = getOctet();
     if (_b != Constants::VERSION1)  // equals 00000000
         return false;
 
-    _b = static_cast<unsigned char>(_stream->get());
+    _b = getOctet();
     if (_b != Constants::VERSION2)  // equals 00000001
         return false;
 
     // c) the bit '0' (padding)
-    _b = static_cast<unsigned char>(_stream->get());
+    _b = getOctet();
     return checkBit(_b, 1) == 0;
 }
 
@@ -90,7 +264,7 @@ void Decoder::getDocument(FI::Document &) {
 bool Decoder::readChildren() {
 
     do {
-        _b = static_cast<unsigned char>(_stream->get());
+        _b = getOctet();
         if (!checkBit(_b, 1)) {  // 0 padding announcing element
             Element element;
             getElement(element);
@@ -109,12 +283,20 @@ bool Decoder::readChildren() {
 void Decoder::getCharacterChunk(FI::CharacterChunk &chunk) {
     getNonIdentifyingStringOrIndex3(chunk.characterCodes);
     if (chunk.characterCodes._addToTable)
-        _vocab->addCharacterChunk(_vocab->resolveCharacterChunk(chunk.characterCodes));
+        addCharacterChunk(chunk.characterCodes);
+}
+
+void Decoder::addAttributeValue(const FI::NonIdentifyingStringOrIndex &value) {
+    _vocab->addAttributeValue(_vocab->resolveAttributeValue(value));
+}
+
+void Decoder::addCharacterChunk(const FI::NonIdentifyingStringOrIndex &value) {
+    _vocab->addCharacterChunk(_vocab->resolveCharacterChunk(value));
 }
 
 bool Decoder::readAttributes(FI::Element &element) {
     if (_b == 0xF0) {
-        _stream->get();
+        getOctet();
         return false;  // Termination detected (no more attributes)
     } else if (_b == 0xFF) {
         return false;
@@ -162,7 +344,7 @@ void Decoder::getElement(FI::Element &element) {
     //_processor->processElementStart(element);
 
     do {
-        _b = static_cast<unsigned char>(_stream->get());
+        _b = getOctet();
 
         if (!checkBit(_b, 1))  // 0 padding announcing element
         {
@@ -179,7 +361,7 @@ void Decoder::getElement(FI::Element &element) {
     //std::cout << "endElement: " << X3DTypes::getElementByID(id) << std::endl;
 
     if ((_b == 0xF0) || ((_b == 0xFF) && hasAttributes))  // Termination handling
-        _stream->get();
+        getOctet();
 }
 
 // C.4
@@ -188,13 +370,58 @@ void Decoder::getAttribute(FI::Attribute &attribute) {
     getQualifiedNameOrIndex2(attribute._qualifiedName);
 
     // NOTE  C.17 always ends on the eighth bit of the same or another octet.
-    _b = static_cast<unsigned char>(_stream->get());  // Get next byte
+    _b = getOctet();  // Get next byte
+    getAttributeValue(attribute);
+}
 
+void Decoder::getAttributeValue(FI::Attribute &attribute) {
     //C.4.4 The value of normalized-value is encoded as described in C.14.
     getNonIdentifyingStringOrIndex1(attribute._normalizedValue);
 
     if (attribute._normalizedValue._addToTable)
-        _vocab->addAttributeValue(_vocab->resolveAttributeValue(attribute._normalizedValue));
+        addAttributeValue(attribute._normalizedValue);
+}
+
+void Decoder::skipAttribute() {
+    FI::QualifiedNameOrIndex name;
+    getQualifiedNameOrIndex2(name);
+    _b = getOctet();
+    skipAttributeValue();
+}
+
+// C.4.4 with the first octet of the value in _b
+void Decoder::skipAttributeValue() {
+    // C.14.3 Literal value without add-to-table, skip the octets of C.19
+    if (!checkBit(_b, 1) && !checkBit(_b, 2)) {
+        switch (_b & Constants::ENCODED_CHARACTER_STRING_3RD_MASK) {
+            case Constants::ENCODED_CHARACTER_STRING_3RD_RESTRICTED_ALPHABET:
+            case Constants::ENCODED_CHARACTER_STRING_3RD_ENCODING_ALGORITHM:
+                getSmallInteger5();
+                break;
+        }
+        skipNonEmptyOctetString5();
+    } else {
+        FI::NonIdentifyingStringOrIndex value;
+        getNonIdentifyingStringOrIndex1(value);
+        if (value._addToTable)
+            addAttributeValue(value);
+    }
+}
+
+void Decoder::skipCharacterChunk() {
+    // C.15.3 Literal chunk without add-to-table, skip the octets of C.20
+    if (!checkBit(_b, 3) && !checkBit(_b, 4)) {
+        switch (_b & Constants::ENCODED_CHARACTER_STRING_5TH_MASK) {
+            case Constants::ENCODED_CHARACTER_STRING_5TH_RESTRICTED_ALPHABET:
+            case Constants::ENCODED_CHARACTER_STRING_5TH_ENCODING_ALGORITHM:
+                getSmallInteger7();
+                break;
+        }
+        skipOctets(getPrefixedValue(LENGTH7_PREFIX[_b]));
+    } else {
+        FI::CharacterChunk chunk;
+        getCharacterChunk(chunk);
+    }
 }
 
 // C.17: Check whether we've got a literal QNAME or surrogate
@@ -207,7 +434,7 @@ void Decoder::getQualifiedNameOrIndex2(FI::QualifiedNameOrIndex &name) {
         bool isPrefixPresent = checkBit(_b, 7) != 0;
         bool isNamespaceNamePresent = checkBit(_b, 8) != 0;
 
-        _b = static_cast<unsigned char>(_stream->get());  // next byte
+        _b = getOctet();  // next byte
 
         // C.17.3.2 If the optional component prefix is present, it is encoded as described in C.13.
         if (isPrefixPresent)
@@ -235,7 +462,7 @@ void Decoder::getQualifiedNameOrIndex3(FI::QualifiedNameOrIndex &name) {
         bool isPrefixPresent = checkBit(_b, 7) != 0;
         bool isNamespaceNamePresent = checkBit(_b, 8) != 0;
 
-        _b = static_cast<unsigned char>(_stream->get());  // next byte
+        _b = getOctet();  // next byte
 
         // C.18.3.2 If the optional component prefix is present, it is encoded as described in C.13.
         if (isPrefixPresent)
@@ -356,203 +583,62 @@ void Decoder::getEncodedCharacterString5(FI::EncodedCharacterString &value) {
 
 // C.22
 void Decoder::getNonEmptyOctetString2(FI::NonEmptyOctetString &value) {
-    int iLength = 0;
-
-    if (!checkBit(_b, 2))  // small
-    {
-        iLength = (_b & Constants::LAST_SIX_BITS) + 1;
-    } else if (_b == Constants::NON_EMPTY_OCTET_STRING_2ND_MEDIUM)  // medium
-    {
-        iLength = static_cast<unsigned int>(_stream->get()) + 65;
-    } else if (_b == Constants::NON_EMPTY_OCTET_STRING_2ND_LARGE) {
-        iLength = (_stream->get() << 24) + (_stream->get() << 16) + (_stream->get() << 8) + _stream->get() + 321;
-    } else
-        throw std::runtime_error("Illegal Octet length encoding");  // Failure
-
-    value.reserve(iLength);
-    for (int i = 0; i < iLength; i++) {
-        value.push_back(static_cast<const char>(_stream->get()));
-    }
+    size_t iLength = getPrefixedValue(LENGTH2_PREFIX[_b]);
+    value.resize(iLength);
+    getOctets(&value[0], iLength);
 }
 
 // C.23
-void Decoder::getNonEmptyOctetString5(FI::NonEmptyOctetString &value) {
-    int iLength = 0;
-
-    // Determine length of the string
-    if (!checkBit(_b, 5))  // small
-    {
-        iLength = (_b & Constants::LAST_THREE_BITS) + 1;
-    } else
-        switch (_b & Constants::LAST_FOUR_BITS) {
-            case Constants::NON_EMPTY_OCTET_STRING_5TH_MEDIUM:
-                iLength = _stream->get() + 9;
-                break;
-            case Constants::NON_EMPTY_OCTET_STRING_5TH_LARGE:
-                iLength = (_stream->get() << 24) + (_stream->get() << 16) + (_stream->get() << 8) + _stream->get() + 265;
-                break;
-            default:
-                throw std::runtime_error("Illegal Octet length encoding");
-        }
+void Decoder::getNonEmptyOctetString5(FI::OctetString &value) {
+    getOctetString(value, getPrefixedValue(LENGTH5_PREFIX[_b]));
+}
 
-    value.reserve(iLength);
-    for (int i = 0; i < iLength; i++) {
-        if (!_stream->good())
-            throw std::runtime_error("Error in stream");
-        value.push_back(static_cast<unsigned char>(_stream->get()));
-    }
+void Decoder::skipNonEmptyOctetString5() {
+    skipOctets(getPrefixedValue(LENGTH5_PREFIX[_b]));
 }
 
 // C.24
-void Decoder::getNonEmptyOctetString7(FI::NonEmptyOctetString &value) {
-    size_t iLength;
-
-    // Determine length of the string
-    if (!checkBit(_b, 7))  // small
-    {
-        iLength = (_b & 0x01) + 1;
-    } else
-        switch (_b & Constants::LAST_TWO_BITS) {
-            case Constants::NON_EMPTY_OCTET_STRING_7TH_MEDIUM:
-                iLength = _stream->get() + 3;
-                break;
-            case Constants::NON_EMPTY_OCTET_STRING_7TH_LARGE:
-                iLength = (_stream->get() << 24) + (_stream->get() << 16) + (_stream->get() << 8) + _stream->get() + 259;
-                break;
-            default:
-                throw std::runtime_error("Illegal Octet length encoding");
-        }
-
-    value.reserve(iLength);
-    for (size_t i = 0; i < iLength; i++)
-        value.push_back(static_cast<const char>(_stream->get()));
+void Decoder::getNonEmptyOctetString7(FI::OctetString &value) {
+    getOctetString(value, getPrefixedValue(LENGTH7_PREFIX[_b]));
 }
 
 // C.25 & C.26
 unsigned int Decoder::getInteger2() {
-    unsigned int iValue;
-    char buf[2];
-
-    if ((_b & Constants::LAST_SEVEN_BITS) == Constants::LAST_SEVEN_BITS)
-        return 0;
-
-    if (!checkBit(_b, 2))  // small, '0' padding
-    {
-        iValue = (_b & Constants::LAST_SIX_BITS) + 1;
-    } else
-        switch (_b & Constants::INTEGER_2ND_LENGTH_MASK) {
-            case Constants::INTEGER_2ND_LENGTH_MEDIUM:
-                iValue = ((_b & Constants::LAST_FIVE_BITS) << 8) + _stream->get() + 65;
-                break;
-            case Constants::INTEGER_3RD_LENGTH_LARGE:
-                _stream->read(buf, 2);
-                iValue = ((_b & Constants::LAST_FOUR_BITS) << 16) + (buf[0] << 8) + buf[1] + 8257;
-                break;
-            default:
-                throw std::runtime_error("Illegal Integer length encoding");
-        }
-
-    return iValue;
+    const PrefixEntry &entry = INTEGER2_PREFIX[_b];
+    // Fast path for the small form used by almost all surrogate indices
+    if (entry._octets == 0)
+        return (_b & entry._mask) + entry._bias;
+    return getPrefixedValue(entry);
 }
 
 // C.27
 unsigned int Decoder::getInteger3() {
-    unsigned int iValue;
-    char buf[3];
-
-    if (!checkBit(_b, 3))  // tiny, '0' padding
-    {
-        iValue = (_b & Constants::LAST_FIVE_BITS) + 1;
-    } else
-        switch (_b & Constants::INTEGER_3RD_LENGTH_MASK) {
-            case Constants::INTEGER_3RD_LENGTH_SMALL:
-                iValue = ((_b & Constants::LAST_THREE_BITS) << 8) + _stream->get() + 33;
-                break;
-            case Constants::INTEGER_3RD_LENGTH_MEDIUM:
-                _stream->read(buf, 2);
-                iValue = ((_b & Constants::LAST_THREE_BITS) << 16) + (buf[0] << 8) + buf[1] + 2081;
-                break;
-            case Constants::INTEGER_3RD_LENGTH_LARGE:
-                if ((_b & Constants::LAST_THREE_BITS) != 0)  // padding
-                    return 0;
-                _stream->read(buf, 3);
-                if ((_b & Constants::FOUR_BITS) != 0)  // padding
-                    return 0;
-                iValue = ((buf[0] & Constants::LAST_FOUR_BITS) << 16) + (buf[1] << 8) + buf[2] + 526369;
-                break;
-            default:
-                return 0;
-        }
-
-    return iValue;
+    const PrefixEntry &entry = INTEGER3_PREFIX[_b];
+    if (entry._octets == 0)
+        return (_b & entry._mask) + entry._bias;
+    return getPrefixedValue(entry);
 }
 
 // C.28
 unsigned int Decoder::getInteger4() {
-    unsigned int iValue;
-    char buf[3];
-
-    if (!checkBit(_b, 4))  // tiny, '0' padding
-    {
-        iValue = (_b & Constants::LAST_FOUR_BITS) + 1;
-    } else
-        switch (_b & Constants::INTEGER_4TH_LENGTH_MASK) {
-            case Constants::INTEGER_4TH_LENGTH_SMALL:
-                iValue = ((_b & Constants::LAST_TWO_BITS) << 8) + _stream->get() + 17;
-                break;
-            case Constants::INTEGER_4TH_LENGTH_MEDIUM:
-                _stream->read(buf, 2);
-                iValue = ((_b & Constants::LAST_TWO_BITS) << 16) + (buf[0] << 8) + buf[1] + 1041;
-                break;
-            case Constants::INTEGER_4TH_LENGTH_LARGE:
-                if ((_b & Constants::LAST_THREE_BITS) != 0)  // padding
-                    return 0;
-                _stream->read(buf, 3);
-                if ((_b & Constants::FOUR_BITS) != 0)  // padding
-                    return 0;
-                iValue = ((buf[0] & Constants::LAST_FOUR_BITS) << 16) + (buf[1] << 8) + buf[2] + 263185;
-                break;
-            default:
-                return 0;
-        }
-
-    return iValue;
+    const PrefixEntry &entry = INTEGER4_PREFIX[_b];
+    if (entry._octets == 0)
+        return (_b & entry._mask) + entry._bias;
+    return getPrefixedValue(entry);
 }
 
 // C.29
 unsigned int Decoder::getSmallInteger5() {
     unsigned int result = (_b & Constants::LAST_FOUR_BITS) << 4;
-    _b = static_cast<unsigned char>(_stream->get());  // next byte
+    _b = getOctet();  // next byte
     return result + ((_b & Constants::FOUR_BITS) >> 4) + 1;
 }
 
 // C.29
 unsigned int Decoder::getSmallInteger7() {
-    return (((_b & Constants::LAST_TWO_BITS) << 6) + (((_b = static_cast<char>(_stream->get())) & Constants::SIX_BITS) >> 2) + 1);
-}
-
-int Decoder::checkBit(unsigned char c, unsigned char iPos) {
-    switch (iPos)  // evtl. schneller als der vergleich mit 2^(8-iPos)
-    {
-        case 1:
-            return (c & 0x80);
-        case 2:
-            return (c & 0x40);
-        case 3:
-            return (c & 0x20);
-        case 4:
-            return (c & 0x10);
-        case 5:
-            return (c & 0x08);
-        case 6:
-            return (c & 0x04);
-        case 7:
-            return (c & 0x02);
-        case 8:
-            return (c & 0x01);
-        default:
-            throw std::range_error("checkBit position must be between 1-8");
-    }
+    unsigned int result = (_b & Constants::LAST_TWO_BITS) << 6;
+    _b = getOctet();  // next byte
+    return result + ((_b & Constants::SIX_BITS) >> 2) + 1;
 }
 
 // C.2.4
@@ -588,15 +674,14 @@ void Decoder::decodeInitialVocabulary() {
     //order) which is present, the number of NameSurrogate items in the component is encoded as described in C.21, and
     //then each item is encoded (in order) as follows: The six bits '000000' (padding) are appended to the bit stream, and the
     //NameSurrogate is encoded as described in C.16.
-    char b, b2;
-    _stream->get(b);
-    _stream->get(b2);
+    unsigned char b = getOctet();
+    unsigned char b2 = getOctet();
 
     if (
         b == 0x10   // 00010000
         && b2 == 0  // 00000000
     ) {
-        _b = static_cast<unsigned char>(_stream->get());  // next byte
+        _b = getOctet();  // next byte
         decodeExternalVocabularyURI();
         return;
     }
@@ -613,10 +698,12 @@ void Decoder::decodeExternalVocabularyURI() {
     if (I == _externalVocabularies.end())
         throw std::runtime_error("externalVocabularyNotRegistered!");
 
-    // Replace default vocabulary by external
-    if (_vocab)
+    // Replace default vocabulary by external. A PushParser decodes the header
+    // again if it was incomplete, then the external vocabulary is already set.
+    if (_vocab != (*I).second) {
         delete _vocab;
-    _vocab = (*I).second;
+        _vocab = (*I).second;
+    }
 }
 
 // C.2.6
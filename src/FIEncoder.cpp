@@ -2,34 +2,147 @@
 #include <xiot/FIEncoder.h>
 #include <xiot/FIEncodingAlgorithms.h>
 
+#include <cstring>
+
 using namespace std;
 
 namespace FI {
 
-FIEncoder::FIEncoder(void) : _stream(NULL) {
+namespace {
+
+/// Large enough to write the arrays of big meshes in a few blocks
+const size_t BUFFER_SIZE = 65536;
+
+/// ITU C.25: The largest index that can be encoded
+const size_t MAX_TABLE_INDEX = 1048576;
+
+/// FNV-1a
+size_t hashString(const std::string &value) {
+    unsigned int hash = 2166136261u;
+    for (std::string::const_iterator I = value.begin(); I != value.end(); I++)
+        hash = (hash ^ static_cast<unsigned char>(*I)) * 16777619u;
+    return hash;
+}
+
+}  // namespace
+
+StringTable::StringTable() : _slots(64, 0) {
+}
+
+unsigned int StringTable::find(const std::string &value) const {
+    size_t mask = _slots.size() - 1;
+    for (size_t slot = hashString(value) & mask; _slots[slot]; slot = (slot + 1) & mask) {
+        if (_values[_slots[slot] - 1] == value)
+            return _slots[slot];
+    }
+    return 0;
+}
+
+void StringTable::add(const std::string &value) {
+    // At most half of the slots are used
+    if ((_values.size() + 1) * 2 > _slots.size())
+        rehash(_slots.size() * 2);
+
+    _values.push_back(value);
+    size_t mask = _slots.size() - 1;
+    size_t slot = hashString(value) & mask;
+    while (_slots[slot])
+        slot = (slot + 1) & mask;
+    _slots[slot] = static_cast<unsigned int>(_values.size());
+}
+
+void StringTable::clear() {
+    _values.clear();
+    _slots.assign(64, 0);
+}
+
+void StringTable::rehash(size_t slots) {
+    _slots.assign(slots, 0);
+    size_t mask = slots - 1;
+    for (size_t i = 0; i < _values.size(); i++) {
+        size_t slot = hashString(_values[i]) & mask;
+        while (_slots[slot])
+            slot = (slot + 1) & mask;
+        _slots[slot] = static_cast<unsigned int>(i + 1);
+    }
+}
+
+FIEncoder::FIEncoder(void) : _buffer(BUFFER_SIZE), _stream(NULL), _seekOnReset(false), _attributeValueTableLimit(0) {
     reset();
 }
 
 FIEncoder::~FIEncoder(void) {
 }
 
-void FIEncoder::setStream(std::ostream &stream) {
+void FIEncoder::setStream(std::ostream &stream, bool seekOnReset) {
     _stream = &stream;
+    _seekOnReset = seekOnReset;
 }
 
 void FIEncoder::reset() {
-    _currentByte = 0;
-    _currentBytePos = 0;
+    // A stream of the caller keeps the previous document
+    if (_stream && !_seekOnReset) {
+        putPendingBytes();
+        flushBuffer();
+    }
+    _bits = 0;
+    _bitCount = 0;
+    _bufferPos = 0;
     _firstLineFeed = true;
-    if (_stream && _stream->good())
-        _stream->seekp(0, ios_base::beg);
+    _attributeValues.clear();
+    for (std::vector<std::string>::const_iterator I = _initialAttributeValues.begin(); I != _initialAttributeValues.end(); I++)
+        _attributeValues.add(*I);
+    _attributeValueStatistics = StringTableStatistics();
+    if (_stream && _seekOnReset && _stream->good())
+        _stream->seekp(0, std::ios_base::beg);
+}
+
+void FIEncoder::putBytes(const unsigned char *bytes, size_t length) {
+    if (getCurrentBytePos() != 0) {
+        assert(false);
+        throw std::runtime_error("Wrong position in FiEncode::PutBytes");
+    }
+    putPendingBytes();
+    if (length >= _buffer.size()) {
+        // Large arrays go to the stream directly
+        flushBuffer();
+        _stream->write(reinterpret_cast<const char *>(bytes), length);
+        return;
+    }
+    if (_bufferPos + length > _buffer.size())
+        flushBuffer();
+    memcpy(&_buffer[_bufferPos], bytes, length);
+    _bufferPos += length;
+}
+
+void FIEncoder::flush() {
+    putPendingBytes();
+    flushBuffer();
+    _stream->flush();
+}
+
+void FIEncoder::putPendingBytes() {
+    while (_bitCount >= 8) {
+        if (_bufferPos == _buffer.size())
+            flushBuffer();
+        _bitCount -= 8;
+        _buffer[_bufferPos++] = static_cast<unsigned char>(_bits >> _bitCount);
+    }
+}
+
+void FIEncoder::flushBuffer() {
+    assert(_stream);
+    if (_bufferPos) {
+        _stream->write(reinterpret_cast<const char *>(&_buffer[0]), _bufferPos);
+        _bufferPos = 0;
+    }
 }
 
 void FIEncoder::encodeHeader(bool) {
     // ITU 12.6: 1110000000000000
-    putBits("1110000000000000");
+    putBits(0xE000, 16);  // 1110000000000000
     // ITU 12.7 / 12.9: Version of standard: 1 as 16bit
-    putBits("0000000000000001");
+    putBits(0x1, 16);  // 0000000000000001
     // ITU 12.8: The bit '0' (padding) shall then be appended to the bit stream
     putBit(0);
 }
@@ -46,10 +159,10 @@ void FIEncoder::encodeInitialVocabulary() {
     putBit(0);  // standalone
     putBit(0);  // and version
     // ITU C.2.5: padding '000' for optional component initial-vocabulary
-    putBits("000");
+    putBits(0x0, 3);  // 000
     // ITU C.2.5.1: For each of the thirteen optional components:
     // presence ? 1 : 0
-    putBits("1000000000000");  // 'external-vocabulary'
+    putBits(0x1000, 13);  // 1000000000000: 'external-vocabulary'
     // ITU C.2.5.2: external-vocabulary is present
     putBit(0);
     encodeNonEmptyOctetString2(NonEmptyOctetString(external_voc.begin(), external_voc.end()));
@@ -64,16 +177,16 @@ void FIEncoder::encodeInitialVocabulary() {
 
 void FIEncoder::encodeDocumentTermination() {
     // ITU C.2.12: The four bits '1111' (termination) are appended
-    putBits("1111");
+    putBits(0xF, 4);  // 1111
 }
 
 void FIEncoder::encodeLineFeed() {
     fillByte();
     if (_firstLineFeed) {
-        putBits("1001000000001010");
+        putBits(0x900A, 16);  // 1001000000001010
         _firstLineFeed = false;
     } else {
-        putBits("10100000");
+        putBits(0xA0, 8);  // 10100000
     }
 }
 
@@ -82,20 +195,67 @@ void FIEncoder::encodeLineFeed() {
 /// on the third bit of an octet
 void FIEncoder::encodeCharacterString3(const std::string &value) {
     // We want to start at position 3
-    assert(_currentBytePos == 2);
+    assert(getCurrentBytePos() == 2);
 
     // ITU C.19.3.1 If the alternative utf-8 is present, then the two bits '00'
     // are appended to the bit stream.
-    putBits("00");
+    putBits(0x0, 2);  // 00
     // ITU C.19.4: The component bytes is encoded as described in C.23.
     encodeNonEmptyByteString5(NonEmptyOctetString(value.begin(), value.end()));
 }
 
+// ITU C.14 Encoding of the NonIdentifyingStringOrIndex type starting
+// on the first bit of an octet
+void FIEncoder::encodeNonIdentifyingStringOrIndex1(const std::string &value, bool addToTable) {
+    // We want to start at position 1
+    assert(getCurrentBytePos() == 0);
+
+    unsigned int index = _attributeValueTableLimit ? _attributeValues.find(value) : 0;
+    if (index) {
+        // ITU C.14.4: If the alternative string-index is present, then the
+        // bit '1' (discriminant) is appended, followed by the index
+        putBit(1);
+        encodeInteger2(index);
+        _attributeValueStatistics.indexed++;
+        return;
+    }
+
+    // The decoder adds the value as well, so it is only marked if it fits.
+    // Without a table the mark is written as requested and never referenced.
+    if (_attributeValueTableLimit) {
+        addToTable = addToTable && _attributeValueStatistics.octets + value.size() <= _attributeValueTableLimit &&
+                     _attributeValues.size() < MAX_TABLE_INDEX;
+        if (addToTable) {
+            _attributeValues.add(value);
+            _attributeValueStatistics.entries++;
+            _attributeValueStatistics.octets += value.size();
+        }
+    }
+    _attributeValueStatistics.literals++;
+
+    // ITU C.14.3: literal-character-string, discriminant '0' and add-to-table
+    putBit(0);
+    putBit(addToTable);
+    encodeCharacterString3(value);
+}
+
+void FIEncoder::setAttributeValueTableLimit(size_t octets) {
+    _attributeValueTableLimit = octets;
+}
+
+size_t FIEncoder::getAttributeValueTableLimit() const {
+    return _attributeValueTableLimit;
+}
+
+const StringTableStatistics &FIEncoder::getAttributeValueTableStatistics() const {
+    return _attributeValueStatistics;
+}
+
 // ITU C.22 Encoding of the NonEmptyOctetString type starting
 // on the second bit of an octet
 void FIEncoder::encodeNonEmptyOctetString2(const NonEmptyOctetString &value) {
     // We want to start at position 2
-    assert(_currentBytePos == 1);
+    assert(getCurrentBytePos() == 1);
     // Non-empty bytes
     assert(!value.empty());
 
@@ -104,10 +264,10 @@ void FIEncoder::encodeNonEmptyOctetString2(const NonEmptyOctetString &value) {
         putBit(0);
         putBits(static_cast<int>(length) - 1, 6);
     } else if (length <= 320) {
-        putBits("10");
+        putBits(0x2, 2);  // 10
         putBits(static_cast<int>(length) - 65, 8);
     } else {
-        putBits("1100");
+        putBits(0xC, 4);  // 1100
         putBits(static_cast<int>(length) - 321, 32);
     }
     writeOctet(value);
@@ -117,7 +277,7 @@ void FIEncoder::encodeNonEmptyOctetString2(const NonEmptyOctetString &value) {
 // on the fifth bit of an byte
 void FIEncoder::encodeNonEmptyByteString5(const NonEmptyOctetString &value) {
     // We want to start at position 5
-    assert(_currentBytePos == 4);
+    assert(getCurrentBytePos() == 4);
     // Non-empty bytes
     assert(!value.empty());
 
@@ -126,10 +286,10 @@ void FIEncoder::encodeNonEmptyByteString5(const NonEmptyOctetString &value) {
         putBit(0);
         putBits(static_cast<int>(length) - 1, 3);
     } else if (length <= 264) {
-        putBits("1000");
+        putBits(0x8, 4);  // 1000
         putBits(static_cast<int>(length) - 9, 8);
     } else {
-        putBits("1100");
+        putBits(0xC, 4);  // 1100
         putBits(static_cast<int>(length) - 265, 32);
     }
     writeOctet(value);
@@ -139,19 +299,19 @@ void FIEncoder::encodeNonEmptyByteString5(const NonEmptyOctetString &value) {
 // starting on the second bit of an byte
 void FIEncoder::encodeInteger2(int value) {
     // We want to start at position 2
-    assert(_currentBytePos == 1);
+    assert(getCurrentBytePos() == 1);
 
     if (value <= 64)  // ITU  C.25.2
     {
-        putBits("0");
+        putBits(0x0, 1);  // 0
         putBits(value - 1, 6);
     } else if (value <= 8256)  // ITU C.25.3
     {
-        putBits("10");
+        putBits(0x2, 2);  // 10
         putBits(value - 65, 13);
     } else  // ITU C.25.4
     {
-        putBits("110");
+        putBits(0x6, 3);  // 110
         putBits(value - 8257, 20);
     }
 }
@@ -160,7 +320,7 @@ void FIEncoder::encodeInteger2(int value) {
 // starting on the third bit of an byte
 void FIEncoder::encodeInteger3(int value) {
     // We want to start at position 3
-    assert(_currentBytePos == 2);
+    assert(getCurrentBytePos() == 2);
 
     if (value <= 32)  // ITU  C.27.2
     {
@@ -168,22 +328,22 @@ void FIEncoder::encodeInteger3(int value) {
         putBits(value - 1, 5);
     } else if (value <= 2080)  // ITU C.27.3
     {
-        putBits("100");
+        putBits(0x4, 3);  // 100
         putBits(value - 33, 11);
     } else if (value < 526368)  // ITU C.27.4
     {
-        putBits("101");
+        putBits(0x5, 3);  // 101
         putBits(value - 2081, 19);
     } else  // ITU C.27.5
     {
-        putBits("1100000000");
+        putBits(0x300, 10);  // 1100000000
         putBits(value - 526369, 20);
     }
 }
 
 void FIEncoder::encodeAttributeFloatArray(const float *values, size_t size) {
     // We want to start at position 3
-    assert(_currentBytePos == 2);
+    assert(getCurrentBytePos() == 2);
 
     // ITU 10.8.1: This encoding algorithm has a vocabulary table index of 7
     encodeEncodingAlgorithmStart(7);
@@ -195,7 +355,7 @@ void FIEncoder::encodeAttributeFloatArray(const float *values, size_t size) {
 
 void FIEncoder::encodeAttributeIntegerArray(const int *values, size_t size) {
     // We want to start at position 3
-    assert(_currentBytePos == 2);
+    assert(getCurrentBytePos() == 2);
 
     // ITU 10.8.1: This encoding algorithm has a vocabulary table index of 4
     encodeEncodingAlgorithmStart(4);
@@ -205,5 +365,16 @@ void FIEncoder::encodeAttributeIntegerArray(const int *values, size_t size) {
     encodeNonEmptyByteString5(octets);
 }
 
+void FIEncoder::encodeAttributeBooleanArray(const std::vector<bool> &values) {
+    // We want to start at position 3
+    assert(getCurrentBytePos() == 2);
+
+    // ITU 10.7.1: This encoding algorithm has a vocabulary table index of 6
+    encodeEncodingAlgorithmStart(6);
+
+    NonEmptyOctetString octets;
+    BooleanEncodingAlgorithm::encode(values, octets);
+    encodeNonEmptyByteString5(octets);
+}
 
 }  // namespace FI
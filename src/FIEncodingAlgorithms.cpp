@@ -5,20 +5,84 @@
 #include <cassert>
 #include <iostream>
 
-#define SWAP_2(x) ((((x)&0xff) << 8) | ((unsigned short)(x) >> 8))
-#define SWAP_4(x) (((x) << 24) |               \
-                   (((x) << 8) & 0x00ff0000) | \
-                   (((x) >> 8) & 0x0000ff00) | \
-                   ((x) >> 24))
-#define FIX_SHORT(x) (*(unsigned short *)&(x) = SWAP_2(*(unsigned short *)&(x)))
-#define FIX_INT(x) (*(unsigned int *)&(x) = SWAP_4(*(unsigned int *)&(x)))
-#define FIX_FLOAT(x) static_cast<float>(FIX_INT(x))
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define FI_HAVE_SSE2
+#include <emmintrin.h>
+#endif
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define FI_HAVE_AVX2
+#include <immintrin.h>
+#endif
 
 
 namespace FI {
 
+namespace {
+
+typedef void (*SwapFunction)(const unsigned char *source, size_t count, unsigned char *dest);
+
+void swapBytes4Scalar(const unsigned char *source, size_t count, unsigned char *dest) {
+    for (size_t i = 0; i < count; i++, source += 4, dest += 4) {
+        unsigned char b0 = source[0], b1 = source[1];
+        dest[0] = source[3];
+        dest[1] = source[2];
+        dest[2] = b1;
+        dest[3] = b0;
+    }
+}
+
+#ifdef FI_HAVE_SSE2
+void swapBytes4SSE2(const unsigned char *source, size_t count, unsigned char *dest) {
+    size_t blocks = count / 4;
+    for (size_t i = 0; i < blocks; i++, source += 16, dest += 16) {
+        __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i *>(source));
+        // Swap the 16 bit halves of each value, then the bytes of each half
+        v = _mm_shufflehi_epi16(_mm_shufflelo_epi16(v, 0xB1), 0xB1);
+        v = _mm_or_si128(_mm_slli_epi16(v, 8), _mm_srli_epi16(v, 8));
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(dest), v);
+    }
+    swapBytes4Scalar(source, count % 4, dest);
+}
+#endif
+
+#ifdef FI_HAVE_AVX2
+__attribute__((target("avx2"))) void swapBytes4AVX2(const unsigned char *source, size_t count, unsigned char *dest) {
+    const __m256i mask = _mm256_setr_epi8(3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12,
+                                          3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12);
+    size_t blocks = count / 8;
+    for (size_t i = 0; i < blocks; i++, source += 32, dest += 32) {
+        __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(source));
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(dest), _mm256_shuffle_epi8(v, mask));
+    }
+    swapBytes4Scalar(source, count % 8, dest);
+}
+#endif
+
+SwapFunction selectSwapFunction() {
+#ifdef FI_HAVE_AVX2
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2"))
+        return swapBytes4AVX2;
+#endif
+#ifdef FI_HAVE_SSE2
+    return swapBytes4SSE2;
+#else
+    return swapBytes4Scalar;
+#endif
+}
+
+/// Selected once when the library is loaded
+const SwapFunction swapFunction = selectSwapFunction();
+
+}  // namespace
 
-std::string FloatEncodingAlgorithm::decodeToString(const FI::NonEmptyOctetString &octets) const {
+void Tools::swapBytes4(const unsigned char *source, size_t count, unsigned char *dest) {
+    swapFunction(source, count, dest);
+}
+
+
+std::string FloatEncodingAlgorithm::decodeToString(const FI::OctetString &octets) const {
     std::vector<float> floatArray;
     decodeToFloatArray(octets, floatArray);
 
@@ -31,33 +95,24 @@ std::string FloatEncodingAlgorithm::decodeToString(const FI::NonEmptyOctetString
     return ss.str();
 }
 
-void FloatEncodingAlgorithm::decodeToFloatArray(const FI::NonEmptyOctetString &octets, std::vector<float> &vec) {
+void FloatEncodingAlgorithm::decodeToFloatArray(const FI::OctetString &octets, std::vector<float> &vec) {
     assert(octets.size() % 4 == 0);
     size_t length = octets.size() / 4;
 
-    const unsigned char *pOctets = &octets.front();
-    std::vector<float> result(length);
-    for (size_t i = 0; i < length; i++) {
-        result[i] = Tools::readFloat(pOctets);
-        pOctets += 4;
-    }
-    std::swap(result, vec);
+    vec.resize(length);
+    if (length)
+        Tools::swapBytes4(&octets.front(), length, reinterpret_cast<unsigned char *>(&vec[0]));
 }
 
 void FloatEncodingAlgorithm::encode(const float *values, size_t size, FI::NonEmptyOctetString &octets) {
-    Tools::float_to_unsigned_int_to_bytes u;
-    for (size_t i = 0; i < size; i++) {
-        float f = values[i];
-        // Avoid -0
-        if (f == 0x80000000) {
-            f = 0;
-        }
-        u.ui = Tools::reverseBytes(reinterpret_cast<int *>(&f));
-        octets.insert(octets.end(), u.ub, u.ub + 4);
-    }
+    if (!size)
+        return;
+    size_t offset = octets.size();
+    octets.resize(offset + size * 4);
+    Tools::swapBytes4(reinterpret_cast<const unsigned char *>(values), size, &octets[offset]);
 }
 
-std::string IntEncodingAlgorithm::decodeToString(const FI::NonEmptyOctetString &octets) const {
+std::string IntEncodingAlgorithm::decodeToString(const FI::OctetString &octets) const {
     std::stringstream ss;
     std::vector<int> intArray;
     decodeToIntArray(octets, intArray);
@@ -71,42 +126,81 @@ std::string IntEncodingAlgorithm::decodeToString(const FI::NonEmptyOctetString &
     return ss.str();
 }
 
-void IntEncodingAlgorithm::decodeToIntArray(const FI::NonEmptyOctetString &octets, std::vector<int> &vec) {
+void IntEncodingAlgorithm::decodeToIntArray(const FI::OctetString &octets, std::vector<int> &vec) {
     assert(octets.size() % 4 == 0);
     size_t length = octets.size() / 4;
 
-    const unsigned char *pOctets = &octets.front();
-    std::vector<int> result(length);
-    for (size_t i = 0; i < length; i++) {
-        result[i] = Tools::readUInt(pOctets);
-        pOctets += 4;
-    }
-    std::swap(result, vec);
+    vec.resize(length);
+    if (length)
+        Tools::swapBytes4(&octets.front(), length, reinterpret_cast<unsigned char *>(&vec[0]));
 }
 
 void IntEncodingAlgorithm::encode(const int *values, size_t size, FI::NonEmptyOctetString &octets) {
-    Tools::float_to_unsigned_int_to_bytes u;
-    for (size_t i = 0; i < size; i++) {
-        u.ui = FIX_INT(values[i]);
-        octets.insert(octets.end(), u.ub, u.ub + 4);
+    if (!size)
+        return;
+    size_t offset = octets.size();
+    octets.resize(offset + size * 4);
+    Tools::swapBytes4(reinterpret_cast<const unsigned char *>(values), size, &octets[offset]);
+}
+
+std::string BooleanEncodingAlgorithm::decodeToString(const FI::OctetString &octets) const {
+    std::vector<bool> boolArray;
+    decodeToBoolArray(octets, boolArray);
+
+    std::string result;
+    result.reserve(boolArray.size() * 6);
+    for (size_t i = 0; i < boolArray.size(); i++) {
+        if (i)
+            result += ' ';
+        result += boolArray[i] ? "true" : "false";
     }
+    return result;
+}
+
+size_t BooleanEncodingAlgorithm::getLength(const FI::OctetString &octets) {
+    // ITU 10.7.2: The four most significant bits of the first octet are the
+    // number of unused bits in the last octet
+    if (octets.empty())
+        throw std::runtime_error("Invalid boolean encoding");
+    unsigned int unused = octets[0] >> 4;
+    size_t bits = octets.size() * 8 - 4;
+    if (unused > 7 || unused > bits)
+        throw std::runtime_error("Invalid boolean encoding");
+    return bits - unused;
 }
 
-std::string BooleanEncodingAlgorithm::decodeToString(const FI::NonEmptyOctetString &) const {
-    throw std::runtime_error("BooleanEncodingAlgorithm not implemented (yet)");
-    /*std::vector<bool> floatArray = decodeToBoolArray(octets);
-		std::stringstream ss;
-		std::vector<bool>::const_iterator I; 
-		for(I = floatArray.begin(); I != floatArray.end() -1; I++)
-		{
-		ss << (*I) << " ";
-		}
-		ss << (*I);
-		return ss.str();*/
+void BooleanEncodingAlgorithm::decodeToBoolArray(const FI::OctetString &octets, std::vector<bool> &vec) {
+    size_t length = getLength(octets);
+    vec.resize(length);
+
+    // The values are stored from the most significant bit on, following the
+    // four bits of the header
+    const unsigned char *data = &octets.front();
+    size_t i = 0;
+    for (; i < length && i < 4; i++)
+        vec[i] = (data[0] & (0x08 >> i)) != 0;
+    for (size_t pos = 1; i < length; pos++) {
+        unsigned char octet = data[pos];
+        size_t end = i + 8 < length ? i + 8 : length;
+        for (unsigned char mask = 0x80; i < end; i++, mask >>= 1)
+            vec[i] = (octet & mask) != 0;
+    }
 }
 
-void BooleanEncodingAlgorithm::decodeToBoolArray(const FI::NonEmptyOctetString &, std::vector<bool> &) {
-    throw std::runtime_error("BooleanEncodingAlgorithm not implemented (yet)");
+void BooleanEncodingAlgorithm::encode(const std::vector<bool> &values, FI::NonEmptyOctetString &octets) {
+    if (values.empty())
+        return;
+    size_t bits = values.size() + 4;
+    size_t size = (bits + 7) / 8;
+    size_t offset = octets.size();
+    octets.resize(offset + size, 0);
+
+    unsigned char *data = &octets[offset];
+    data[0] = static_cast<unsigned char>((size * 8 - bits) << 4);
+    for (size_t i = 0; i < values.size(); i++) {
+        if (values[i])
+            data[(i + 4) / 8] |= static_cast<unsigned char>(0x80 >> ((i + 4) % 8));
+    }
 }
 
 }  // namespace FI
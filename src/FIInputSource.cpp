@@ -0,0 +1,177 @@
+#include <xiot/FIInputSource.h>
+
+#include <stdexcept>
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace FI {
+
+MemoryInputSource::MemoryInputSource(const void *data, size_t length) {
+    setData(data, length);
+}
+
+MemoryInputSource::~MemoryInputSource() {
+}
+
+void MemoryInputSource::setData(const void *data, size_t length) {
+    _data = static_cast<const unsigned char *>(data);
+    _length = length;
+    _delivered = false;
+}
+
+bool MemoryInputSource::nextBlock(const unsigned char *&begin, const unsigned char *&end) {
+    if (_delivered || _length == 0)
+        return false;
+    begin = _data;
+    end = _data + _length;
+    _delivered = true;
+    return true;
+}
+
+
+MemoryMappedInputSource::MemoryMappedInputSource() : _mapping(NULL) {
+#ifdef _WIN32
+    _fileHandle = INVALID_HANDLE_VALUE;
+    _mappingHandle = NULL;
+#endif
+}
+
+MemoryMappedInputSource::~MemoryMappedInputSource() {
+    close();
+}
+
+#ifdef _WIN32
+
+bool MemoryMappedInputSource::open(const char *fileName) {
+    close();
+    HANDLE file = CreateFileA(fileName, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, NULL);
+    if (file == INVALID_HANDLE_VALUE)
+        return false;
+
+    LARGE_INTEGER size;
+    if (GetFileType(file) != FILE_TYPE_DISK || !GetFileSizeEx(file, &size) || size.QuadPart == 0) {
+        CloseHandle(file);
+        return false;
+    }
+
+    HANDLE mapping = CreateFileMappingA(file, NULL, PAGE_READONLY, 0, 0, NULL);
+    if (mapping == NULL) {
+        CloseHandle(file);
+        return false;
+    }
+
+    void *view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    if (view == NULL) {
+        CloseHandle(mapping);
+        CloseHandle(file);
+        return false;
+    }
+
+    _fileHandle = file;
+    _mappingHandle = mapping;
+    _mapping = view;
+    setData(view, static_cast<size_t>(size.QuadPart));
+    return true;
+}
+
+void MemoryMappedInputSource::close() {
+    if (_mapping != NULL)
+        UnmapViewOfFile(_mapping);
+    if (_mappingHandle != NULL)
+        CloseHandle(_mappingHandle);
+    if (_fileHandle != INVALID_HANDLE_VALUE)
+        CloseHandle(_fileHandle);
+    _mapping = NULL;
+    _mappingHandle = NULL;
+    _fileHandle = INVALID_HANDLE_VALUE;
+    setData(NULL, 0);
+}
+
+#else
+
+bool MemoryMappedInputSource::open(const char *fileName) {
+    close();
+    int fd = ::open(fileName, O_RDONLY);
+    if (fd == -1)
+        return false;
+
+    struct stat info;
+    if (fstat(fd, &info) != 0 || !S_ISREG(info.st_mode) || info.st_size == 0) {
+        ::close(fd);
+        return false;
+    }
+
+    size_t length = static_cast<size_t>(info.st_size);
+    void *view = mmap(NULL, length, PROT_READ, MAP_PRIVATE, fd, 0);
+    // The mapping keeps its own reference to the file
+    ::close(fd);
+    if (view == MAP_FAILED)
+        return false;
+
+#ifdef MADV_SEQUENTIAL
+    madvise(view, length, MADV_SEQUENTIAL);
+#endif
+
+    _mapping = view;
+    setData(view, length);
+    return true;
+}
+
+void MemoryMappedInputSource::close() {
+    if (_mapping != NULL)
+        munmap(_mapping, _length);
+    _mapping = NULL;
+    setData(NULL, 0);
+}
+
+#endif
+
+
+BufferedInputSource::BufferedInputSource(std::istream *stream, size_t blockSize) : _stream(stream), _buffer(blockSize > 0 ? blockSize : 1) {
+}
+
+BufferedInputSource::~BufferedInputSource() {
+}
+
+void BufferedInputSource::setStream(std::istream *stream) {
+    _stream = stream;
+}
+
+bool BufferedInputSource::nextBlock(const unsigned char *&begin, const unsigned char *&end) {
+    if (!_stream || !_stream->good())
+        return false;
+
+    _stream->read(reinterpret_cast<char *>(&_buffer[0]), static_cast<std::streamsize>(_buffer.size()));
+    std::streamsize count = _stream->gcount();
+    if (count <= 0)
+        return false;
+
+    begin = &_buffer[0];
+    end = begin + count;
+    return true;
+}
+
+size_t BufferedInputSource::skip(size_t length) {
+    if (!_stream || !_stream->good() || length == 0)
+        return 0;
+
+    std::streampos start = _stream->tellg();
+    if (start == std::streampos(-1))
+        return 0;  // Not seekable
+
+    // Read the last skipped octet to detect the end of the input
+    _stream->seekg(static_cast<std::streamoff>(length - 1), std::ios::cur);
+    if (!_stream->good() || _stream->get() == std::istream::traits_type::eof())
+        throw std::runtime_error("Unexpected end of input");
+    return length;
+}
+
+}  // namespace FI
@@ -103,6 +103,7 @@ DefaultParserVocabulary::DefaultParserVocabulary(const char *uri) : _externalVoc
 void DefaultParserVocabulary::initEncodingAlgorithms() {
     _encodingAlgorithms.insert(_encodingAlgorithms.begin(), Constants::ENCODING_ALGORITHM_BUILTIN_END, NULL);
     _encodingAlgorithms[IntEncodingAlgorithm::ALGORITHM_ID] = &_intEncodingAlgorithm;
+    _encodingAlgorithms[BooleanEncodingAlgorithm::ALGORITHM_ID] = &_booleanEncodingAlgorithm;
     _encodingAlgorithms[FloatEncodingAlgorithm::ALGORITHM_ID] = &_floatEncodingAlgorithm;
 }
 
@@ -0,0 +1,124 @@
+#include <xiot/FIConstants.h>
+#include <xiot/FIPullParser.h>
+
+namespace FI {
+
+PullParser::PullParser() : _state(STATE_HEADER), _pendingEnds(0) {
+    _arena = &_callbackArena;
+}
+
+PullParser::~PullParser() {
+}
+
+PullParser::EventType PullParser::next() {
+    // The data of the last event is not needed anymore
+    _attributes.clear();
+    _callbackArena.reset();
+
+    if (_pendingEnds) {
+        _pendingEnds--;
+        return endElement();
+    }
+
+    switch (_state) {
+        case STATE_HEADER:
+            return processHeader();
+        case STATE_CONTENT:
+            return processContent();
+        default:
+            throw std::runtime_error("No more events after the end of the document");
+    }
+}
+
+PullParser::EventType PullParser::processHeader() {
+    bool isDocument = detectFIDocument();
+    if (isDocument)
+        processDocumentProperties();
+    completeItem();
+
+    if (!isDocument)
+        throw std::runtime_error("Input is not a Fast Infoset document.");
+    _state = STATE_CONTENT;
+    return START_DOCUMENT;
+}
+
+PullParser::EventType PullParser::processContent() {
+    if (isEndOfInput())
+        throw std::runtime_error("Unexpected end of input");
+
+    _b = getOctet();
+    if (!checkBit(_b, 1)) {  // 0 padding announcing element
+        return processElement();
+    } else if (!_elements.empty() && (_b & Constants::TWO_BITS) == Constants::ELEMENT_CHARACTER_CHUNK) {
+        _characterChunk = FI::CharacterChunk();
+        Decoder::getCharacterChunk(_characterChunk);
+        completeItem();
+        return CHARACTERS;
+    } else if (_b == Constants::TERMINATOR_SINGLE ||
+               _b == Constants::TERMINATOR_DOUBLE) {
+        completeItem();
+        // The double terminator also terminates the parent
+        if (_b == Constants::TERMINATOR_DOUBLE)
+            _pendingEnds = 1;
+        return endElement();
+    }
+    throw std::runtime_error(_elements.empty() ? "message.decodingDIIs" : "message.decodingEIIs");
+}
+
+PullParser::EventType PullParser::processElement() {
+    Element element;
+    // C.3.3 If the optional component attributes is present, then the bit '1' (presence) is appended to the bit stream;
+    // otherwise, the bit '0' (absence) is appended.
+    bool hasAttributes = checkBit(_b, 2) != 0;
+
+    // C.3.4.1 The four bits '1110' (presence) and the two bits '00' (padding) are appended to the bit stream.
+    // check for namespace attributes
+    if ((_b & Constants::ELEMENT_NAMESPACE_ATTRIBUTES_MASK) == Constants::ELEMENT_NAMESPACE_ATTRIBUTES_FLAG) {
+        throw std::runtime_error("No namespace support yet");
+    }
+
+    // C.3.5 The value of the component qualified-name is encoded as described in C.18.
+    getQualifiedNameOrIndex3(element._qualifiedName);
+
+    bool doubleTerminated = false;
+    if (hasAttributes) {
+        processAttributes();
+        doubleTerminated = _b == Constants::TERMINATOR_DOUBLE;
+    }
+    completeItem();
+
+    // The double terminator after the attributes also terminates the element
+    if (doubleTerminated)
+        _pendingEnds = 1;
+    _elements.push_back(element);
+    _element = element;
+    return START_ELEMENT;
+}
+
+void PullParser::processAttributes() {
+    for (;;) {
+        _b = getOctet();
+        if (!checkBit(_b, 1)) {
+            // Decode in place to avoid copying the value
+            _attributes.resize(_attributes.size() + 1);
+            getAttribute(_attributes.back());
+        } else if (_b == Constants::TERMINATOR_SINGLE ||
+                   _b == Constants::TERMINATOR_DOUBLE) {
+            return;
+        } else
+            throw std::runtime_error("message.decodingAIIs");
+    }
+}
+
+PullParser::EventType PullParser::endElement() {
+    if (_elements.empty()) {
+        _state = STATE_FINISHED;
+        _pendingEnds = 0;
+        return END_DOCUMENT;
+    }
+    _element = _elements.back();
+    _elements.pop_back();
+    return END_ELEMENT;
+}
+
+}  // namespace FI
@@ -0,0 +1,122 @@
+#include <xiot/FIContentHandler.h>
+#include <xiot/FIParserVocabulary.h>
+#include <xiot/FIPushParser.h>
+
+namespace FI {
+
+bool PushParser::Window::nextBlock(const unsigned char *&begin, const unsigned char *&end) {
+    if (MemoryInputSource::nextBlock(begin, end))
+        return true;
+    _exhausted = true;
+    return false;
+}
+
+
+PushParser::PushParser() : _contentHandler(NULL) {
+}
+
+PushParser::~PushParser() {
+}
+
+void PushParser::setContentHandler(ContentHandler *handler) {
+    _contentHandler = handler;
+}
+
+void PushParser::parse(const void *data, size_t length, bool isFinal) {
+    const unsigned char *begin = static_cast<const unsigned char *>(data);
+    const unsigned char *end = begin + length;
+    bool buffered = !_buffer.empty();
+
+    // Append to the incomplete item of the last chunk, otherwise decode in place
+    if (buffered) {
+        _buffer.insert(_buffer.end(), begin, end);
+        begin = &_buffer[0];
+        end = begin + _buffer.size();
+    }
+
+    size_t consumed = 0;
+    while (hasNext() && begin + consumed != end) {
+        if (!processItem(begin, end, consumed))
+            break;
+    }
+
+    // Keep the octets of the incomplete item, anything after the document is ignored
+    if (!hasNext())
+        _buffer.clear();
+    else if (buffered)
+        _buffer.erase(_buffer.begin(), _buffer.begin() + consumed);
+    else
+        _buffer.assign(begin + consumed, end);
+
+    if (isFinal && hasNext())
+        throw std::runtime_error("Unexpected end of input");
+}
+
+bool PushParser::processItem(const unsigned char *begin, const unsigned char *end, size_t &consumed) {
+    _window._exhausted = false;
+    _window.setData(begin + consumed, end - begin - consumed);
+    setInputSource(&_window);
+
+    try {
+        EventType event = next();
+        consumed = _pos - begin;
+        dispatch(event);
+        // A terminator can end more than one element
+        while (hasPendingEvent())
+            dispatch(next());
+        return true;
+    } catch (std::exception &) {
+        // Reading beyond the received octets is not an error, the item
+        // is decoded again when the next chunk arrives
+        if (!_window._exhausted)
+            throw;
+    }
+
+    _pendingAttributeValues.clear();
+    _pendingCharacterChunks.clear();
+    return false;
+}
+
+void PushParser::dispatch(EventType event) {
+    switch (event) {
+        case START_DOCUMENT:
+            _contentHandler->startDocument();
+            break;
+        case END_DOCUMENT:
+            _contentHandler->endDocument();
+            break;
+        case START_ELEMENT:
+            _contentHandler->startElement(_vocab, getElement(), getAttributes());
+            break;
+        case END_ELEMENT:
+            _contentHandler->endElement(_vocab, getElement());
+            break;
+        case CHARACTERS:
+            _contentHandler->characters(_vocab, getCharacterChunk());
+            break;
+    }
+}
+
+void PushParser::completeItem() {
+    // getOctet() returns a terminator if the input is exhausted, so
+    // the item may look complete even though it is not
+    if (_window._exhausted)
+        throw std::runtime_error("Unexpected end of input");
+
+    for (size_t i = 0; i < _pendingAttributeValues.size(); i++)
+        _vocab->addAttributeValue(_pendingAttributeValues[i]);
+    for (size_t i = 0; i < _pendingCharacterChunks.size(); i++)
+        _vocab->addCharacterChunk(_pendingCharacterChunks[i]);
+    _pendingAttributeValues.clear();
+    _pendingCharacterChunks.clear();
+}
+
+void PushParser::addAttributeValue(const FI::NonIdentifyingStringOrIndex &value) {
+    _pendingAttributeValues.push_back(_vocab->resolveAttributeValue(value));
+}
+
+void PushParser::addCharacterChunk(const FI::NonIdentifyingStringOrIndex &value) {
+    _pendingCharacterChunks.push_back(_vocab->resolveCharacterChunk(value));
+}
+
+}  // namespace FI
@@ -6,6 +6,10 @@
 namespace FI {
 
 
+SAXParser::SAXParser() : _contentHandler(NULL), _terminated(false), _doubleTerminated(false), _skipping(false) {
+    _arena = &_callbackArena;
+}
+
 SAXParser::~SAXParser() {
 }
 
@@ -14,7 +18,7 @@ void SAXParser::setContentHandler(ContentHandler *handler) {
 }
 
 void SAXParser::parse() {
-    _terminated = _doubleTerminated = false;
+    _terminated = _doubleTerminated = _skipping = false;
     if (!detectFIDocument())
         throw std::runtime_error("Input is not a Fast Infoset document.");
     processDocument();
@@ -26,7 +30,9 @@ void SAXParser::processDocument() {
 
     // Process children
     while (!_terminated) {
-        _b = static_cast<unsigned char>(_stream->get());
+        if (isEndOfInput())
+            throw std::runtime_error("Unexpected end of input");
+        _b = getOctet();
         if (!checkBit(_b, 1)) {  // 0 padding announcing element
             processElement();
         }
@@ -54,13 +60,18 @@ void SAXParser::processElement() {
     getQualifiedNameOrIndex3(element._qualifiedName);
 
     if (hasAttributes)
-        processAttributes();
-
-    _contentHandler->startElement(_vocab, element, _attributes);
-    _attributes.clear();
+        processAttributes(element);
+
+    // No callbacks inside of a skipped subtree
+    bool skipped = _skipping;
+    if (!skipped) {
+        _contentHandler->startElement(_vocab, element, _attributes);
+        _attributes.clear();
+        _callbackArena.reset();
+    }
 
     while (!_terminated) {
-        _b = static_cast<unsigned char>(_stream->get());
+        _b = getOctet();
         if (!checkBit(_b, 1)) {  // 0 padding announcing element
             processElement();
         } else if ((_b & Constants::TWO_BITS) == Constants::ELEMENT_CHARACTER_CHUNK) {
@@ -72,19 +83,32 @@ void SAXParser::processElement() {
         } else
             throw std::runtime_error("message.decodingEIIs");
     }
-    _contentHandler->endElement(_vocab, element);
+    _skipping = skipped;
+    if (!skipped)
+        _contentHandler->endElement(_vocab, element);
 
     _terminated = _doubleTerminated;
     _doubleTerminated = false;
 }
 
-void SAXParser::processAttributes() {
+void SAXParser::processAttributes(const Element &element) {
     do {
-        _b = static_cast<unsigned char>(_stream->get());
+        _b = getOctet();
         if (!checkBit(_b, 1)) {
-            FI::Attribute attribute;
-            getAttribute(attribute);
-            _attributes.push_back(attribute);
+            if (_skipping) {
+                skipAttribute();
+            } else {
+                // Decode in place to avoid copying the value
+                _attributes.resize(_attributes.size() + 1);
+                FI::Attribute &attribute = _attributes.back();
+                getQualifiedNameOrIndex2(attribute._qualifiedName);
+                _b = getOctet();
+                if (_contentHandler->isAttributeOfInterest(_vocab, element, attribute._qualifiedName)) {
+                    getAttributeValue(attribute);
+                } else if (!getSkippedAttributeValue(element, attribute)) {
+                    _attributes.pop_back();
+                }
+            }
         } else if (_b == Constants::TERMINATOR_SINGLE ||
                    _b == Constants::TERMINATOR_DOUBLE) {
             _terminated = true;
@@ -98,10 +122,34 @@ void SAXParser::processAttributes() {
     _doubleTerminated = false;
 }
 
+// Returns true, if the value was decoded
+bool SAXParser::getSkippedAttributeValue(const Element &element, Attribute &attribute) {
+    // C.14.3 Only a literal without add-to-table, encoded with an algorithm (C.19.3.4)
+    if (checkBit(_b, 1) || checkBit(_b, 2) ||
+        (_b & Constants::ENCODED_CHARACTER_STRING_3RD_MASK) != Constants::ENCODED_CHARACTER_STRING_3RD_ENCODING_ALGORITHM) {
+        skipAttributeValue();
+        return false;
+    }
+    FI::EncodedCharacterString &value = attribute._normalizedValue._characterString;
+    value._encodingFormat = FI::ENCODINGFORMAT_ENCODING_ALGORITHM;
+    value._encodingAlgorithm = getSmallInteger5();
+    if (!_contentHandler->isEncodedAttributeOfInterest(_vocab, element, attribute._qualifiedName, value._encodingAlgorithm)) {
+        skipNonEmptyOctetString5();
+        return false;
+    }
+    getNonEmptyOctetString5(value._octets);
+    return true;
+}
+
 void SAXParser::processCharacterChunk() {
+    if (_skipping) {
+        skipCharacterChunk();
+        return;
+    }
     FI::CharacterChunk chunk;
     getCharacterChunk(chunk);
     _contentHandler->characters(_vocab, chunk);
+    _callbackArena.reset();
 }
 
 
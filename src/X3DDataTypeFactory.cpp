@@ -130,6 +130,23 @@ void X3DDataTypeFactory::getMFFloatFromString(const std::string &s, MFFloat &val
     std::swap(vec, value);
 }
 
+void X3DDataTypeFactory::getMFBoolFromString(const std::string &s, MFBool &value) {
+    MFBool vec;
+    size_t pos = 0;
+
+    while (pos < s.size()) {
+        while (pos < s.size() && isWhiteSpaceOrComma(s[pos]))
+            pos++;
+        size_t end = pos;
+        while (end < s.size() && !isWhiteSpaceOrComma(s[end]))
+            end++;
+        if (end > pos)
+            vec.push_back(getSFBoolFromString(s.substr(pos, end - pos)));
+        pos = end;
+    }
+    std::swap(vec, value);
+}
+
 void X3DDataTypeFactory::getMFInt32FromString(const std::string &s, MFInt32 &value) {
     MFInt32 vec;
     std::istringstream ss(s, istringstream::in);
@@ -0,0 +1,50 @@
+#include <xiot/X3DEventReader.h>
+#include <xiot/X3DFIEventReader.h>
+#include <xiot/X3DTypes.h>
+#include <xiot/X3DXMLEventReader.h>
+
+#include <cassert>
+
+namespace XIOT {
+
+X3DEventReader::X3DEventReader() : _eventType(START_DOCUMENT), _elementID(-1) {
+}
+
+X3DEventReader::~X3DEventReader() {
+}
+
+X3DEventReader *X3DEventReader::create(const char *fileStr) {
+    std::string fileName(fileStr);
+    std::string extensionStr = fileName.substr(fileName.find_last_of('.') + 1, fileName.size());
+
+    X3DEventReader *reader = NULL;
+    if (extensionStr == "x3d")
+        reader = new X3DXMLEventReader();
+    else if (extensionStr == "x3db")
+        reader = new X3DFIEventReader();
+
+    if (reader && !reader->open(fileStr)) {
+        delete reader;
+        reader = NULL;
+    }
+    return reader;
+}
+
+void X3DEventReader::skipChildren() {
+    assert(_eventType == START_ELEMENT);
+    int depth = 1;
+    while (depth) {
+        switch (next()) {
+            case START_ELEMENT:
+                depth++;
+                break;
+            case END_ELEMENT:
+                depth--;
+                break;
+            default:
+                break;
+        }
+    }
+}
+
+}  // namespace XIOT
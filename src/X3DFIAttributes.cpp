@@ -1,38 +1,84 @@
 #include <xiot/X3DFIAttributes.h>
 
+#include <algorithm>
 #include <iostream>
 
 #include <xiot/FIConstants.h>
 #include <xiot/FITypes.h>
+#include <xiot/X3DFICodecRegistry.h>
 #include <xiot/X3DFICompressionTools.h>
 #include <xiot/X3DFIEncodingAlgorithms.h>
 #include <xiot/X3DParseException.h>
 #include <xiot/X3DParserVocabulary.h>
 
-#define getValueAt(index) _impl->_attributes->at((index))._normalizedValue
+#define getValueAt(index) _attributes->at((index))._normalizedValue
 
 namespace XIOT {
 
-class FIAttributeImpl {
-  public:
-    FI::Attributes *_attributes;
-    FI::ParserVocabulary *_vocab;
-};
+X3DFIMeshContext::X3DFIMeshContext() : _depth(0) {
+}
+
+void X3DFIMeshContext::startElement(int elementID, const FI::Attributes &attributes) {
+    _depth++;
+    int indexID;
+    if (elementID == ID::IndexedFaceSet)
+        indexID = ID::coordIndex;
+    else if (elementID == ID::IndexedTriangleSet)
+        indexID = ID::index;
+    else
+        return;
+
+    for (FI::Attributes::const_iterator I = attributes.begin(); I != attributes.end(); I++) {
+        const FI::NonIdentifyingStringOrIndex &value = (*I)._normalizedValue;
+        if ((*I)._qualifiedName._nameSurrogateIndex == static_cast<unsigned int>(indexID + 1) && value._stringIndex == FI::INDEX_NOT_SET &&
+            value._characterString._encodingFormat == FI::ENCODINGFORMAT_ENCODING_ALGORITHM &&
+            value._characterString._encodingAlgorithm == MeshIndexAlgorithm::ALGORITHM_ID) {
+            Mesh mesh;
+            mesh.depth = _depth;
+            mesh.decoded = false;
+            _meshes.push_back(mesh);
+            // The octets may refer to a buffer of the parser
+            _meshes.back().octets = value._characterString._octets;
+            _meshes.back().octets.retain();
+            return;
+        }
+    }
+}
+
+void X3DFIMeshContext::endElement() {
+    if (!_meshes.empty() && _meshes.back().depth == _depth)
+        _meshes.pop_back();
+    _depth--;
+}
+
+void X3DFIMeshContext::clear() {
+    _meshes.clear();
+    _depth = 0;
+}
+
+const std::vector<int> *X3DFIMeshContext::getMeshIndex() const {
+    if (_meshes.empty())
+        return NULL;
+    Mesh &mesh = _meshes.back();
+    if (!mesh.decoded) {
+        MeshIndexAlgorithm::decodeToIntArray(mesh.octets, mesh.index);
+        mesh.decoded = true;
+    }
+    return &mesh.index;
+}
 
-X3DFIAttributes::X3DFIAttributes(const void *const attributes, const FI::ParserVocabulary *vocab) : _impl(new FIAttributeImpl()) {
-    _impl->_attributes = (FI::Attributes *)attributes;
-    _impl->_vocab = (FI::ParserVocabulary *)vocab;
+X3DFIAttributes::X3DFIAttributes(const void *const attributes, const FI::ParserVocabulary *vocab, const X3DFIMeshContext *meshContext)
+    : _attributes(static_cast<const FI::Attributes *>(attributes)), _vocab(vocab), _meshContext(meshContext) {
 }
 
 X3DFIAttributes::~X3DFIAttributes() {
-    delete _impl;
 }
 
 
 int X3DFIAttributes::getAttributeIndex(int attributeID) const {
     int i = 0;
-    for (std::vector<FI::Attribute>::const_iterator I = _impl->_attributes->begin();
-         I != _impl->_attributes->end(); I++, i++) {
+    for (std::vector<FI::Attribute>::const_iterator I = _attributes->begin();
+         I != _attributes->end(); I++, i++) {
         if ((*I)._qualifiedName._nameSurrogateIndex == static_cast<unsigned int>(attributeID + 1))
             return i;
     }
@@ -40,41 +86,54 @@ int X3DFIAttributes::getAttributeIndex(int attributeID) const {
 }
 
 size_t X3DFIAttributes::getLength() const {
-    return _impl->_attributes->size();
+    return _attributes->size();
 }
 
 std::string X3DFIAttributes::getAttributeValue(int id) const {
-    return _impl->_vocab->resolveAttributeValue(_impl->_attributes->at(id)._normalizedValue);
+    const FI::NonIdentifyingStringOrIndex &value = getValueAt(id);
+    if (value._stringIndex == FI::INDEX_NOT_SET && value._characterString._encodingFormat == FI::ENCODINGFORMAT_ENCODING_ALGORITHM &&
+        value._characterString._encodingAlgorithm == MeshCoordinateAlgorithm::ALGORITHM_ID) {
+        // The algorithm can not decode the points without the mesh
+        std::vector<float> vec;
+        getFloatArray(value, vec);
+        std::stringstream ss;
+        for (size_t i = 0; i < vec.size(); i++)
+            ss << (i ? " " : "") << vec[i];
+        return ss.str();
+    }
+    return _vocab->resolveAttributeValue(_attributes->at(id)._normalizedValue);
 }
 
 std::string X3DFIAttributes::getAttributeName(int id) const {
-    return _impl->_vocab->resolveAttributeName(_impl->_attributes->at(id)._qualifiedName)._localName;
+    return _vocab->resolveAttributeName(_attributes->at(id)._qualifiedName)._localName;
 }
 
 // Single fields
 bool X3DFIAttributes::getSFBool(int index) const {
-    FI::NonIdentifyingStringOrIndex value = getValueAt(index);
+    const FI::NonIdentifyingStringOrIndex &value = getValueAt(index);
     if (value._stringIndex == X3DParserVocabulary::ATTRIBUT_VALUE_TRUE_INDEX)
         return true;
     if (value._stringIndex == X3DParserVocabulary::ATTRIBUT_VALUE_FALSE_INDEX)
         return false;
     if (value._stringIndex == FI::INDEX_NOT_SET)
-        return X3DDataTypeFactory::getSFBoolFromString(_impl->_vocab->resolveAttributeValue(value));
+        return X3DDataTypeFactory::getSFBoolFromString(_vocab->resolveAttributeValue(value));
 
     throw X3DParseException("Unknown SFBool encoding");
 }
 
 float X3DFIAttributes::getSFFloat(int index) const {
-    std::vector<float> result;
-    getFloatArray(getValueAt(index), result);
-    if (result.size() == 1) {
-        return result[0];
-    } else
-        throw X3DParseException("Wrong size for SFFloat");
+    float value;
+    getSingleFloats(index, &value, 1, "SFFloat");
+    return value;
 }
 int X3DFIAttributes::getSFInt32(int index) const {
+    const FI::NonIdentifyingStringOrIndex &value = getValueAt(index);
+    if (value._stringIndex == FI::INDEX_NOT_SET && value._characterString._encodingFormat == FI::ENCODINGFORMAT_ENCODING_ALGORITHM &&
+        value._characterString._encodingAlgorithm == FI::IntEncodingAlgorithm::ALGORITHM_ID && value._characterString._octets.size() == 4)
+        return static_cast<int>(FI::Tools::readUInt(value._characterString._octets.data()));
+
     std::vector<int> result;
-    getIntArray(getValueAt(index), result);
+    getIntArray(value, result);
     if (result.size() == 1) {
         return result[0];
     } else
@@ -82,63 +141,48 @@ int X3DFIAttributes::getSFInt32(int index) const {
 }
 
 void X3DFIAttributes::getSFVec3f(int index, SFVec3f &value) const {
-    std::vector<float> result;
-    getFloatArray(getValueAt(index), result);
-    if (result.size() == 3) {
-        value.x = result[0];
-        value.y = result[1];
-        value.z = result[2];
-    } else
-        throw X3DParseException("Wrong size for SFVec3f");
+    float result[3];
+    getSingleFloats(index, result, 3, "SFVec3f");
+    value.x = result[0];
+    value.y = result[1];
+    value.z = result[2];
 }
 
 void X3DFIAttributes::getSFVec2f(int index, SFVec2f &value) const {
-    std::vector<float> result;
-    getFloatArray(getValueAt(index), result);
-    if (result.size() == 2) {
-        value.x = result[0];
-        value.y = result[1];
-    } else
-        throw X3DParseException("Wrong size for SFVec2f");
+    float result[2];
+    getSingleFloats(index, result, 2, "SFVec2f");
+    value.x = result[0];
+    value.y = result[1];
 }
 
 void X3DFIAttributes::getSFRotation(int index, SFRotation &value) const {
-    std::vector<float> result;
-    getFloatArray(getValueAt(index), result);
-    if (result.size() == 4) {
-        value.x = result[0];
-        value.y = result[1];
-        value.z = result[2];
-        value.angle = result[3];
-    } else
-        throw X3DParseException("Wrong size for SFRotation");
+    float result[4];
+    getSingleFloats(index, result, 4, "SFRotation");
+    value.x = result[0];
+    value.y = result[1];
+    value.z = result[2];
+    value.angle = result[3];
 }
 
 void X3DFIAttributes::getSFString(int index, SFString &value) const {
-    value.assign(_impl->_vocab->resolveAttributeValue(getValueAt(index)));
+    value.assign(_vocab->resolveAttributeValue(getValueAt(index)));
 }
 
 void X3DFIAttributes::getSFColor(int index, SFColor &value) const {
-    std::vector<float> result;
-    getFloatArray(getValueAt(index), result);
-    if (result.size() == 3) {
-        value.r = result[0];
-        value.g = result[1];
-        value.b = result[2];
-    } else
-        throw X3DParseException("Wrong size for SFColor");
+    float result[3];
+    getSingleFloats(index, result, 3, "SFColor");
+    value.r = result[0];
+    value.g = result[1];
+    value.b = result[2];
 }
 
 void X3DFIAttributes::getSFColorRGBA(int index, SFColorRGBA &value) const {
-    std::vector<float> result;
-    getFloatArray(getValueAt(index), result);
-    if (result.size() == 4) {
-        value.r = result[0];
-        value.g = result[1];
-        value.b = result[2];
-        value.a = result[3];
-    } else
-        throw X3DParseException("Wrong size for SFColorRGBA");
+    float result[4];
+    getSingleFloats(index, result, 4, "SFColorRGBA");
+    value.r = result[0];
+    value.g = result[1];
+    value.b = result[2];
+    value.a = result[3];
 }
 
 void X3DFIAttributes::getSFImage(int index, SFImage &value) const {
@@ -152,6 +196,17 @@ void X3DFIAttributes::getSFImage(int index, SFImage &value) const {
 }
 
 // Multi Field
+void X3DFIAttributes::getMFBool(int index, MFBool &value) const {
+    const FI::NonIdentifyingStringOrIndex &v = getValueAt(index);
+    if (v._stringIndex == FI::INDEX_NOT_SET && v._characterString._encodingFormat == FI::ENCODINGFORMAT_ENCODING_ALGORITHM &&
+        v._characterString._encodingAlgorithm == FI::BooleanEncodingAlgorithm::ALGORITHM_ID) {
+        FI::BooleanEncodingAlgorithm::decodeToBoolArray(v._characterString._octets, value);
+        return;
+    }
+    // Textual values and the vocabulary entries for "true" and "false"
+    X3DDataTypeFactory::getMFBoolFromString(_vocab->resolveAttributeValue(v), value);
+}
+
 void X3DFIAttributes::getMFFloat(int index, MFFloat &value) const {
     getFloatArray(getValueAt(index), value);
 }
@@ -205,7 +260,7 @@ void X3DFIAttributes::getMFRotation(int index, MFRotation &value) const {
 }
 
 void X3DFIAttributes::getMFString(int index, MFString &value) const {
-    return X3DDataTypeFactory::getMFStringFromString(_impl->_vocab->resolveAttributeValue(getValueAt(index)), value);
+    return X3DDataTypeFactory::getMFStringFromString(_vocab->resolveAttributeValue(getValueAt(index)), value);
 }
 
 void X3DFIAttributes::getMFColor(int index, MFColor &value) const {
@@ -240,48 +295,104 @@ void X3DFIAttributes::getMFColorRGBA(int index, MFColorRGBA &value) const {
 
 void X3DFIAttributes::getFloatArray(const FI::NonIdentifyingStringOrIndex &value, std::vector<float> &vec) const {
     if (value._stringIndex == FI::INDEX_NOT_SET && value._characterString._encodingFormat == FI::ENCODINGFORMAT_ENCODING_ALGORITHM) {
-        switch (value._characterString._encodingAlgorithm) {
-            case QuantizedzlibFloatArrayAlgorithm::ALGORITHM_ID: {
-                QuantizedzlibFloatArrayAlgorithm::decodeToFloatArray(value._characterString._octets, vec);
-                break;
-            }
-            case FI::FloatEncodingAlgorithm::ALGORITHM_ID: {
-                FI::FloatEncodingAlgorithm::decodeToFloatArray(value._characterString._octets, vec);
-                break;
-            }
-            default: {
-                std::stringstream ss;
-                ss << "Encoding Algortihm with id <" << value._characterString._encodingAlgorithm << "> is not known for encoding of float arrays." << std::endl;
-                throw X3DParseException(ss.str());
-            }
+        int algorithmID = value._characterString._encodingAlgorithm;
+        if (algorithmID == MeshCoordinateAlgorithm::ALGORITHM_ID) {
+            const std::vector<int> *index = _meshContext ? _meshContext->getMeshIndex() : NULL;
+            if (!index)
+                throw X3DParseException("MeshCoordinateAlgorithm: No mesh index for the points");
+            MeshCoordinateAlgorithm::decodeToFloatArray(value._characterString._octets, *index, vec);
+            return;
         }
+        const X3DFICodec *codec = X3DFICodecRegistry::getInstance().findByID(algorithmID);
+        if (!codec || !codec->decodeFloatArray) {
+            std::stringstream ss;
+            ss << "Encoding Algortihm with id <" << algorithmID << "> is not known for encoding of float arrays." << std::endl;
+            throw X3DParseException(ss.str());
+        }
+        codec->decodeFloatArray(value._characterString._octets, vec);
         return;
     }
     // This is for not algorithm encoded values
-    X3DDataTypeFactory::getMFFloatFromString(_impl->_vocab->resolveAttributeValue(value), vec);
+    X3DDataTypeFactory::getMFFloatFromString(_vocab->resolveAttributeValue(value), vec);
+}
+
+void X3DFIAttributes::getSingleFloats(int index, float *values, size_t count, const char *fieldType) const {
+    const FI::NonIdentifyingStringOrIndex &value = getValueAt(index);
+    // Written with Property::BinarySingleFields, decoded without a temporary array
+    if (value._stringIndex == FI::INDEX_NOT_SET && value._characterString._encodingFormat == FI::ENCODINGFORMAT_ENCODING_ALGORITHM &&
+        value._characterString._encodingAlgorithm == FI::FloatEncodingAlgorithm::ALGORITHM_ID && value._characterString._octets.size() == count * 4) {
+        FI::Tools::swapBytes4(value._characterString._octets.data(), count, reinterpret_cast<unsigned char *>(values));
+        return;
+    }
+
+    std::vector<float> result;
+    getFloatArray(value, result);
+    if (result.size() != count)
+        throw X3DParseException(std::string("Wrong size for ") + fieldType);
+    std::copy(result.begin(), result.end(), values);
 }
 
 void X3DFIAttributes::getIntArray(const FI::NonIdentifyingStringOrIndex &value, std::vector<int> &vec) const {
     if (value._stringIndex == FI::INDEX_NOT_SET && value._characterString._encodingFormat == FI::ENCODINGFORMAT_ENCODING_ALGORITHM) {
-        switch (value._characterString._encodingAlgorithm) {
-            case DeltazlibIntArrayAlgorithm::ALGORITHM_ID: {
-                DeltazlibIntArrayAlgorithm::decodeToIntArray(value._characterString._octets, vec);
-                break;
-            }
-            case FI::IntEncodingAlgorithm::ALGORITHM_ID: {
-                FI::IntEncodingAlgorithm::decodeToIntArray(value._characterString._octets, vec);
-                break;
-            }
-            default: {
-                std::stringstream ss;
-                ss << "Encoding Algortihm with id <" << value._characterString._encodingAlgorithm << "> is not known for encoding of int arrays." << std::endl;
-                throw X3DParseException(ss.str());
-            }
+        int algorithmID = value._characterString._encodingAlgorithm;
+        const X3DFICodec *codec = X3DFICodecRegistry::getInstance().findByID(algorithmID);
+        if (!codec || !codec->decodeIntArray) {
+            std::stringstream ss;
+            ss << "Encoding Algortihm with id <" << algorithmID << "> is not known for encoding of int arrays." << std::endl;
+            throw X3DParseException(ss.str());
         }
+        codec->decodeIntArray(value._characterString._octets, vec);
         return;
     }
     // This is for not algorithm encoded values
-    X3DDataTypeFactory::getMFInt32FromString(_impl->_vocab->resolveAttributeValue(value), vec);
+    X3DDataTypeFactory::getMFInt32FromString(_vocab->resolveAttributeValue(value), vec);
+}
+
+size_t X3DFIAttributes::getArrayLength(int index) const {
+    const FI::NonIdentifyingStringOrIndex &value = getValueAt(index);
+    if (value._stringIndex == FI::INDEX_NOT_SET && value._characterString._encodingFormat == FI::ENCODINGFORMAT_ENCODING_ALGORITHM) {
+        if (value._characterString._encodingAlgorithm == FI::BooleanEncodingAlgorithm::ALGORITHM_ID)
+            return FI::BooleanEncodingAlgorithm::getLength(value._characterString._octets);
+        const X3DFICodec *codec = X3DFICodecRegistry::getInstance().findByID(value._characterString._encodingAlgorithm);
+        if (codec && codec->getLength)
+            return codec->getLength(value._characterString._octets);
+        if (codec && !codec->decodeFloatArray) {
+            std::vector<int> vec;
+            getIntArray(value, vec);
+            return vec.size();
+        }
+    }
+    std::vector<float> vec;
+    getFloatArray(value, vec);
+    return vec.size();
+}
+
+void X3DFIAttributes::getFloatRange(int index, size_t first, size_t count, std::vector<float> &vec, int threads) const {
+    const FI::NonIdentifyingStringOrIndex &value = getValueAt(index);
+    if (value._stringIndex == FI::INDEX_NOT_SET && value._characterString._encodingFormat == FI::ENCODINGFORMAT_ENCODING_ALGORITHM &&
+        value._characterString._encodingAlgorithm == BlockzlibArrayAlgorithm::ALGORITHM_ID) {
+        BlockzlibArrayAlgorithm::decodeToFloatArray(value._characterString._octets, vec, first, count, threads);
+        return;
+    }
+    std::vector<float> all;
+    getFloatArray(value, all);
+    first = std::min(first, all.size());
+    count = std::min(count, all.size() - first);
+    std::vector<float>(all.begin() + first, all.begin() + first + count).swap(vec);
+}
+
+void X3DFIAttributes::getIntRange(int index, size_t first, size_t count, std::vector<int> &vec, int threads) const {
+    const FI::NonIdentifyingStringOrIndex &value = getValueAt(index);
+    if (value._stringIndex == FI::INDEX_NOT_SET && value._characterString._encodingFormat == FI::ENCODINGFORMAT_ENCODING_ALGORITHM &&
+        value._characterString._encodingAlgorithm == BlockzlibArrayAlgorithm::ALGORITHM_ID) {
+        BlockzlibArrayAlgorithm::decodeToIntArray(value._characterString._octets, vec, first, count, threads);
+        return;
+    }
+    std::vector<int> all;
+    getIntArray(value, all);
+    first = std::min(first, all.size());
+    count = std::min(count, all.size() - first);
+    std::vector<int>(all.begin() + first, all.begin() + first + count).swap(vec);
 }
 
 
@@ -0,0 +1,198 @@
+#include <xiot/X3DFICodecRegistry.h>
+
+#include <cstring>
+
+#include <xiot/FIConstants.h>
+#include <xiot/X3DParseException.h>
+#include <xiot/X3DTypes.h>
+
+namespace XIOT {
+
+namespace {
+
+FI::IntEncodingAlgorithm intEncodingAlgorithm;
+FI::FloatEncodingAlgorithm floatEncodingAlgorithm;
+DeltazlibIntArrayAlgorithm deltazlibIntArrayAlgorithm;
+QuantizedzlibFloatArrayAlgorithm quantizedzlibFloatArrayAlgorithm;
+BlockzlibArrayAlgorithm blockzlibArrayAlgorithm;
+ShufflezlibFloatArrayAlgorithm shufflezlibFloatArrayAlgorithm;
+MeshIndexAlgorithm meshIndexAlgorithm;
+MeshCoordinateAlgorithm meshCoordinateAlgorithm;
+VarintzlibIntArrayAlgorithm varintzlibIntArrayAlgorithm;
+
+bool sameURI(const char *a, const char *b) {
+    return a == b || (a && b && strcmp(a, b) == 0);
+}
+
+size_t getBuiltInLength(const FI::OctetString &octets) {
+    return octets.size() / 4;
+}
+
+/// Deltazlib, MeshIndex and Varintzlib start with the number of values
+size_t getLengthFromHeader(const FI::OctetString &octets) {
+    if (octets.size() < 4)
+        throw X3DParseException("Invalid encoded int array");
+    return FI::Tools::readUInt(octets.data());
+}
+
+size_t getQuantizedzlibLength(const FI::OctetString &octets) {
+    // After the exponent and mantissa bits and the length
+    if (octets.size() < 10)
+        throw X3DParseException("Invalid QuantizedzlibFloatArrayAlgorithm data");
+    return FI::Tools::readUInt(octets.data() + 6);
+}
+
+void decodeBlockzlibInts(const FI::OctetString &octets, std::vector<int> &vec) {
+    BlockzlibArrayAlgorithm::decodeToIntArray(octets, vec);
+}
+
+void decodeBlockzlibFloats(const FI::OctetString &octets, std::vector<float> &vec) {
+    BlockzlibArrayAlgorithm::decodeToFloatArray(octets, vec);
+}
+
+void encodeBuiltInInts(const int *values, size_t size, FI::NonEmptyOctetString &octets, const CodecSettings &) {
+    FI::IntEncodingAlgorithm::encode(values, size, octets);
+}
+
+void encodeBuiltInFloats(const float *values, size_t size, FI::NonEmptyOctetString &octets, const CodecSettings &) {
+    FI::FloatEncodingAlgorithm::encode(values, size, octets);
+}
+
+void encodeDeltazlib(const int *values, size_t size, FI::NonEmptyOctetString &octets, const CodecSettings &settings) {
+    DeltazlibIntArrayAlgorithm::encode(values, size, octets, false, settings.parallelCompression);
+}
+
+void encodeQuantizedzlib(const float *values, size_t size, FI::NonEmptyOctetString &octets, const CodecSettings &settings) {
+    QuantizedzlibFloatArrayAlgorithm::encode(values, size, octets, settings.floatQuantization, settings.parallelCompression);
+}
+
+void encodeBlockzlibInts(const int *values, size_t size, FI::NonEmptyOctetString &octets, const CodecSettings &settings) {
+    BlockzlibArrayAlgorithm::encode(values, size, octets, settings.parallelCompression);
+}
+
+void encodeBlockzlibFloats(const float *values, size_t size, FI::NonEmptyOctetString &octets, const CodecSettings &settings) {
+    BlockzlibArrayAlgorithm::encode(values, size, octets, settings.parallelCompression);
+}
+
+void encodeShufflezlib(const float *values, size_t size, FI::NonEmptyOctetString &octets, const CodecSettings &settings) {
+    ShufflezlibFloatArrayAlgorithm::encode(values, size, octets, settings.stride, settings.parallelCompression);
+}
+
+void encodeVarintzlib(const int *values, size_t size, FI::NonEmptyOctetString &octets, const CodecSettings &settings) {
+    VarintzlibIntArrayAlgorithm::encode(values, size, octets, settings.parallelCompression);
+}
+
+X3DFICodec createCodec(const char *uri, int algorithmID, FI::IEncodingAlgorithm *algorithm, X3DFICodec::GetLengthFunction getLength) {
+    X3DFICodec codec;
+    codec.uri = uri;
+    codec.algorithmID = algorithmID;
+    codec.algorithm = algorithm;
+    codec.getLength = getLength;
+    return codec;
+}
+
+}  // namespace
+
+X3DFICodecRegistry &X3DFICodecRegistry::getInstance() {
+    static X3DFICodecRegistry registry;
+    return registry;
+}
+
+X3DFICodecRegistry::X3DFICodecRegistry() {
+    X3DFICodec codec = createCodec(Encoder::BuiltIn, FI::IntEncodingAlgorithm::ALGORITHM_ID, &intEncodingAlgorithm, &getBuiltInLength);
+    codec.decodeIntArray = &FI::IntEncodingAlgorithm::decodeToIntArray;
+    codec.encodeIntArray = &encodeBuiltInInts;
+    add(codec);
+
+    codec = createCodec(Encoder::BuiltIn, FI::FloatEncodingAlgorithm::ALGORITHM_ID, &floatEncodingAlgorithm, &getBuiltInLength);
+    codec.decodeFloatArray = &FI::FloatEncodingAlgorithm::decodeToFloatArray;
+    codec.encodeFloatArray = &encodeBuiltInFloats;
+    add(codec);
+
+    codec = createCodec(Encoder::DeltazlibIntArrayEncoder, DeltazlibIntArrayAlgorithm::ALGORITHM_ID, &deltazlibIntArrayAlgorithm, &getLengthFromHeader);
+    codec.decodeIntArray = &DeltazlibIntArrayAlgorithm::decodeToIntArray;
+    codec.encodeIntArray = &encodeDeltazlib;
+    add(codec);
+
+    codec = createCodec(Encoder::QuantizedzlibFloatArrayEncoder, QuantizedzlibFloatArrayAlgorithm::ALGORITHM_ID, &quantizedzlibFloatArrayAlgorithm,
+                        &getQuantizedzlibLength);
+    codec.decodeFloatArray = &QuantizedzlibFloatArrayAlgorithm::decodeToFloatArray;
+    codec.encodeFloatArray = &encodeQuantizedzlib;
+    add(codec);
+
+    codec = createCodec(Encoder::BlockzlibArrayEncoder, BlockzlibArrayAlgorithm::ALGORITHM_ID, &blockzlibArrayAlgorithm, &BlockzlibArrayAlgorithm::getLength);
+    codec.decodeIntArray = &decodeBlockzlibInts;
+    codec.decodeFloatArray = &decodeBlockzlibFloats;
+    codec.encodeIntArray = &encodeBlockzlibInts;
+    codec.encodeFloatArray = &encodeBlockzlibFloats;
+    add(codec);
+
+    codec = createCodec(Encoder::ShufflezlibFloatArrayEncoder, ShufflezlibFloatArrayAlgorithm::ALGORITHM_ID, &shufflezlibFloatArrayAlgorithm,
+                        &ShufflezlibFloatArrayAlgorithm::getLength);
+    codec.decodeFloatArray = &ShufflezlibFloatArrayAlgorithm::decodeToFloatArray;
+    codec.encodeFloatArray = &encodeShufflezlib;
+    add(codec);
+
+    // The mesh algorithms are encoded by the X3DWriterFI with Property::MeshCompression,
+    // the points are decoded by the X3DFIAttributes with the index of the mesh
+    codec = createCodec(Encoder::MeshIndexEncoder, MeshIndexAlgorithm::ALGORITHM_ID, &meshIndexAlgorithm, &getLengthFromHeader);
+    codec.decodeIntArray = &MeshIndexAlgorithm::decodeToIntArray;
+    add(codec);
+
+    codec = createCodec(Encoder::MeshCoordinateEncoder, MeshCoordinateAlgorithm::ALGORITHM_ID, &meshCoordinateAlgorithm, &MeshCoordinateAlgorithm::getLength);
+    add(codec);
+
+    codec = createCodec(Encoder::VarintzlibIntArrayEncoder, VarintzlibIntArrayAlgorithm::ALGORITHM_ID, &varintzlibIntArrayAlgorithm, &getLengthFromHeader);
+    codec.decodeIntArray = &VarintzlibIntArrayAlgorithm::decodeToIntArray;
+    codec.encodeIntArray = &encodeVarintzlib;
+    add(codec);
+}
+
+bool X3DFICodecRegistry::registerCodec(const X3DFICodec &codec) {
+    // Index 256 is the largest that fits the 8 bits of the encoding
+    if (codec.algorithmID <= static_cast<int>(FI::Constants::ENCODING_ALGORITHM_APPLICATION_START) || codec.algorithmID > 256)
+        return false;
+    if (!codec.algorithm || (!codec.decodeIntArray && !codec.decodeFloatArray) || findByID(codec.algorithmID))
+        return false;
+    if ((codec.encodeIntArray && findIntArrayEncoder(codec.uri)) || (codec.encodeFloatArray && findFloatArrayEncoder(codec.uri)))
+        return false;
+    add(codec);
+    return true;
+}
+
+void X3DFICodecRegistry::add(const X3DFICodec &codec) {
+    std::list<X3DFICodec>::iterator I = _codecs.begin();
+    while (I != _codecs.end() && (*I).algorithmID < codec.algorithmID)
+        I++;
+    _codecs.insert(I, codec);
+}
+
+const X3DFICodec *X3DFICodecRegistry::findByID(int algorithmID) const {
+    for (std::list<X3DFICodec>::const_iterator I = _codecs.begin(); I != _codecs.end(); I++) {
+        if ((*I).algorithmID == algorithmID)
+            return &(*I);
+    }
+    return NULL;
+}
+
+const X3DFICodec *X3DFICodecRegistry::findIntArrayEncoder(const char *uri) const {
+    for (std::list<X3DFICodec>::const_iterator I = _codecs.begin(); I != _codecs.end(); I++) {
+        if ((*I).encodeIntArray && sameURI((*I).uri, uri))
+            return &(*I);
+    }
+    return NULL;
+}
+
+const X3DFICodec *X3DFICodecRegistry::findFloatArrayEncoder(const char *uri) const {
+    for (std::list<X3DFICodec>::const_iterator I = _codecs.begin(); I != _codecs.end(); I++) {
+        if ((*I).encodeFloatArray && sameURI((*I).uri, uri))
+            return &(*I);
+    }
+    return NULL;
+}
+
+const std::list<X3DFICodec> &X3DFICodecRegistry::getCodecs() const {
+    return _codecs;
+}
+
+}  // namespace XIOT
@@ -1,123 +1,245 @@
 #include <xiot/X3DFICompressionTools.h>
 
+#include <algorithm>
 #include <cassert>
 #include <cstring>
 #include <stdexcept>
 #include <string>
 
+#include "zlib.h"
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <pthread.h>
+#include <unistd.h>
+#endif
+
 #define EXPONENT_MASK_32 0x7f800000
 #define MANTISSA_MASK_32 0x007fffff
 #define EXPONENT_BIAS_32 127
 #define MANTISSA_BITS_32 23
 #define SIGN_SHIFT_32 31
-#define PACKER_BUFFER_SIZE 1024
 namespace XIOT {
 namespace FITools {
 
-BitPacker::BitPacker() {
-    buffer.resize(PACKER_BUFFER_SIZE, 0);
-    next_bit_to_write = 0;
-}
-
-
-// Fast version of pack()
-const int BITS_PER_WORD = 32;
-void BitPacker::pack(unsigned long value, unsigned long num_bits_to_pack) {
-    assert(num_bits_to_pack <= 32);
-    assert((value & ((1 << num_bits_to_pack) - 1)) == value);
-
-    // Scoot the value bits up to the top of the word; this makes
-    // them easier to work with.
-
-    value <<= (BITS_PER_WORD - num_bits_to_pack);
-
-    // First we do the hard part: pack bits into the first unsigned char,
-    // which may already have bits in it.
-
-    int byte_index = (next_bit_to_write / 8);
-    int bit_index = (next_bit_to_write % 8);
-    int empty_space_this_byte = (8 - bit_index) & 0x7;
-
-    // Update next_bit_to_write for the next call; we don't need
-    // the old value any more.
-
-    next_bit_to_write += num_bits_to_pack;
+namespace {
+
+/// The deflate window, each block is primed with this much preceding data
+const std::size_t WINDOW_SIZE = 32768;
+
+struct DeflateJob {
+    const unsigned char *data;
+    std::size_t length;
+    std::size_t blockSize;
+    std::size_t numBlocks;
+    int level;
+    std::vector<std::vector<unsigned char> > blocks;
+    std::vector<uLong> checksums;
+    std::vector<char> failed;
+};
+
+/**
+ * Deflates one block to a raw deflate stream. All but the last block end
+ * with a sync flush, so they can be concatenated.
+ */
+bool deflateBlock(DeflateJob &job, std::size_t block) {
+    std::size_t begin = block * job.blockSize;
+    uInt length = static_cast<uInt>(std::min(job.blockSize, job.length - begin));
+    int flush = block + 1 == job.numBlocks ? Z_FINISH : Z_SYNC_FLUSH;
+
+    z_stream strm;
+    memset(&strm, 0, sizeof(strm));
+    if (deflateInit2(&strm, job.level, Z_DEFLATED, -MAX_WBITS, 8, Z_DEFAULT_STRATEGY) != Z_OK)
+        return false;
+    if (begin) {
+        uInt dictLength = static_cast<uInt>(std::min(begin, WINDOW_SIZE));
+        deflateSetDictionary(&strm, const_cast<Bytef *>(job.data + begin - dictLength), dictLength);
+    }
 
-    unsigned char *dest = &buffer.front() + byte_index;
+    std::vector<unsigned char> &out = job.blocks[block];
+    strm.next_in = const_cast<Bytef *>(job.data + begin);
+    strm.avail_in = length;
+    std::size_t written = 0;
+    int ret;
+    do {
+        // The bound does not cover the flush marker
+        out.resize(written + deflateBound(&strm, strm.avail_in) + 16);
+        strm.next_out = &out[written];
+        strm.avail_out = static_cast<uInt>(out.size() - written);
+        ret = deflate(&strm, flush);
+        written = out.size() - strm.avail_out;
+    } while (ret == Z_OK && strm.avail_out == 0);
+    deflateEnd(&strm);
+    out.resize(written);
+
+    job.checksums[block] = adler32(adler32(0L, Z_NULL, 0), job.data + begin, length);
+    return flush == Z_FINISH ? ret == Z_STREAM_END : ret == Z_OK;
+}
 
-    if (empty_space_this_byte) {
-        unsigned int to_copy = empty_space_this_byte;
-        int align = 0;
+void deflateTask(void *context, std::size_t block) {
+    DeflateJob &job = *static_cast<DeflateJob *>(context);
+    job.failed[block] = !deflateBlock(job, block);
+}
 
-        if (to_copy > num_bits_to_pack) {
-            // We don't have enough bits to fill up this unsigned char.
-            align = to_copy - num_bits_to_pack;
-            to_copy = num_bits_to_pack;
-        }
+/// Worker i runs the tasks i, i + stride, ...
+struct Worker {
+    void (*task)(void *, std::size_t);
+    void *context;
+    std::size_t count;
+    std::size_t index;
+    std::size_t stride;
+};
+
+void runWorker(Worker *worker) {
+    for (std::size_t i = worker->index; i < worker->count; i += worker->stride)
+        worker->task(worker->context, i);
+}
 
-        unsigned long fill_bits = value >> (BITS_PER_WORD - empty_space_this_byte);
-        *dest |= fill_bits;
+#ifdef _WIN32
+DWORD WINAPI workerThread(LPVOID arg) {
+    runWorker(static_cast<Worker *>(arg));
+    return 0;
+}
+#else
+void *workerThread(void *arg) {
+    runWorker(static_cast<Worker *>(arg));
+    return NULL;
+}
+#endif
+
+/// The zlib header as written by deflate() for the level
+void appendZlibHeader(std::vector<unsigned char> &result, int level) {
+    if (level == Z_DEFAULT_COMPRESSION)
+        level = 6;
+    unsigned int levelFlags = level < 2 ? 0 : level < 6 ? 1 : level == 6 ? 2 : 3;
+    unsigned int header = ((Z_DEFLATED + ((MAX_WBITS - 8) << 4)) << 8) | (levelFlags << 6);
+    header += 31 - header % 31;
+    result.push_back(static_cast<unsigned char>(header >> 8));
+    result.push_back(static_cast<unsigned char>(header));
+}
 
-        num_bits_to_pack -= to_copy;
-        dest++;
-        value <<= to_copy;
+}  // namespace
+
+bool compress(const unsigned char *data, std::size_t length, std::vector<unsigned char> &result, int level, int threads, std::size_t blockSize) {
+    if (threads <= 0)
+        threads = getNumberOfProcessors();
+    // Blocks are passed to zlib in one piece
+    blockSize = std::max(std::min(blockSize, static_cast<std::size_t>(1) << 30), WINDOW_SIZE);
+
+    if (threads == 1 || length <= blockSize) {
+        uLongf compressedSize = compressBound(static_cast<uLong>(length));
+        result.resize(compressedSize);
+        if (compress2(&result.front(), &compressedSize, data, static_cast<uLong>(length), level) != Z_OK)
+            return false;
+        result.resize(compressedSize);
+        return true;
     }
 
-    // Now we do the fast and easy part for what is hopefully
-    // the bulk of the data.
-
-    while (value) {
-        *dest++ = value >> (BITS_PER_WORD - 8);
-        value <<= 8;
+    DeflateJob job;
+    job.data = data;
+    job.length = length;
+    job.blockSize = blockSize;
+    job.numBlocks = (length + blockSize - 1) / blockSize;
+    job.level = level;
+    job.blocks.resize(job.numBlocks);
+    job.checksums.resize(job.numBlocks);
+    job.failed.resize(job.numBlocks);
+
+    parallelFor(job.numBlocks, threads, deflateTask, &job);
+    if (std::find(job.failed.begin(), job.failed.end(), 1) != job.failed.end())
+        return false;
+
+    result.clear();
+    appendZlibHeader(result, level);
+    uLong checksum = adler32(0L, Z_NULL, 0);
+    for (std::size_t i = 0; i < job.numBlocks; i++) {
+        result.insert(result.end(), job.blocks[i].begin(), job.blocks[i].end());
+        std::size_t blockLength = std::min(blockSize, length - i * blockSize);
+        checksum = adler32_combine(checksum, job.checksums[i], static_cast<z_off_t>(blockLength));
     }
+    for (int shift = 24; shift >= 0; shift -= 8)
+        result.push_back(static_cast<unsigned char>(checksum >> shift));
+    return true;
 }
 
-void BitPacker::get_result(char **data_return, int *len_return) {
-    int len_in_bytes = (next_bit_to_write + 7) / 8;
-    *len_return = len_in_bytes;
+void parallelFor(std::size_t count, int threads, void (*task)(void *context, std::size_t index), void *context) {
+    if (threads <= 0)
+        threads = getNumberOfProcessors();
+    std::size_t numWorkers = std::min(static_cast<std::size_t>(threads), count);
+    if (numWorkers <= 1) {
+        for (std::size_t i = 0; i < count; i++)
+            task(context, i);
+        return;
+    }
 
-    assert(*len_return <= PACKER_BUFFER_SIZE);
+    std::vector<Worker> workers(numWorkers);
+    for (std::size_t i = 0; i < numWorkers; i++) {
+        workers[i].task = task;
+        workers[i].context = context;
+        workers[i].count = count;
+        workers[i].index = i;
+        workers[i].stride = numWorkers;
+    }
 
-    *data_return = (char *)&buffer.front();
+    // Worker 0 runs on the calling thread. If a thread can not be
+    // started, its worker runs there as well.
+#ifdef _WIN32
+    std::vector<HANDLE> handles(numWorkers, (HANDLE)NULL);
+    for (std::size_t i = 1; i < numWorkers; i++) {
+        handles[i] = CreateThread(NULL, 0, workerThread, &workers[i], 0, NULL);
+        if (!handles[i])
+            runWorker(&workers[i]);
+    }
+    runWorker(&workers[0]);
+    for (std::size_t i = 1; i < numWorkers; i++) {
+        if (handles[i]) {
+            WaitForSingleObject(handles[i], INFINITE);
+            CloseHandle(handles[i]);
+        }
+    }
+#else
+    std::vector<pthread_t> handles(numWorkers);
+    std::vector<bool> started(numWorkers, false);
+    for (std::size_t i = 1; i < numWorkers; i++) {
+        started[i] = pthread_create(&handles[i], NULL, workerThread, &workers[i]) == 0;
+        if (!started[i])
+            runWorker(&workers[i]);
+    }
+    runWorker(&workers[0]);
+    for (std::size_t i = 1; i < numWorkers; i++) {
+        if (started[i])
+            pthread_join(handles[i], NULL);
+    }
+#endif
 }
 
-
-BitUnpacker::BitUnpacker(unsigned char *data, size_t len) {
-    if (len > buffer.size())
-        buffer.resize(len);
-
-    memcpy(&buffer.front(), data, len);
-    num_bits_remaining = static_cast<unsigned int>(len * 8);
-    next_bit_to_read = 0;
+int getNumberOfProcessors() {
+#ifdef _WIN32
+    SYSTEM_INFO info;
+    GetSystemInfo(&info);
+    int count = static_cast<int>(info.dwNumberOfProcessors);
+#else
+    int count = static_cast<int>(sysconf(_SC_NPROCESSORS_ONLN));
+#endif
+    return count > 0 ? count : 1;
 }
 
-unsigned long BitUnpacker::unpack(unsigned long num_bits_to_unpack) {
-    unsigned long result = 0;
-
-    assert(num_bits_to_unpack <= num_bits_remaining);
-
-    while (num_bits_to_unpack) {
-        unsigned long byte_index = (next_bit_to_read / 8);
-        unsigned long bit_index = (next_bit_to_read % 8);
-
-        unsigned long src_mask = (1 << (7 - bit_index));
-        unsigned long dest_mask = (1 << (num_bits_to_unpack - 1));
-
-        if (buffer[byte_index] & src_mask)
-            result |= dest_mask;
-        num_bits_to_unpack--;
-        next_bit_to_read++;
+const std::vector<unsigned char> &BitPacker::getResult() {
+    if (_count) {
+        pack(0, 8 - _count);
     }
+    return _buffer;
+}
 
-    num_bits_remaining -= num_bits_to_unpack;
-
-    return result;
+BitUnpacker::BitUnpacker(const unsigned char *data, size_t len, unsigned int firstBit) : _begin(data), _data(data + firstBit / 8), _end(data + len), _bits(0), _count(0) {
+    unpack(firstBit % 8);
 }
 
 FloatPacker::FloatPacker(unsigned long exponentBits, unsigned long mantissaBits) : _exponentBits(exponentBits),
                                                                                    _mantissaBits(mantissaBits) {
-    if (_exponentBits > 8) {
-        throw std::range_error("Exponent bits out of range, max 8");
+    if (_exponentBits < 1 || _exponentBits > 8) {
+        throw std::range_error("Exponent bits out of range, min 1, max 8");
     }
     if (_mantissaBits > 23) {
         throw std::range_error("Too many mantissa bits, max: 23");
@@ -132,30 +254,46 @@ FloatPacker::FloatPacker(unsigned long exponentBits, unsigned long mantissaBits)
     _exponent_min = -_exponent_max - 1;
 }
 
-float FloatPacker::decode(unsigned long src, bool isSigned) {
-    if (src == 0)
-        return 0.0f;
-
-    int mantissa = (src & _mantissa_mask);
-    int exponent = (int)(src & _exponent_mask) >> _mantissaBits;
-    long sign = (src >> _sign_shift);
-
-    exponent += _exponent_min;
-    exponent += EXPONENT_BIAS_32;
-
-    mantissa = mantissa << (MANTISSA_BITS_32 - _mantissaBits);
-    unsigned int result = isSigned ? (sign << SIGN_SHIFT_32) | (exponent << MANTISSA_BITS_32) | (mantissa)
-                                   : (exponent << MANTISSA_BITS_32) | (mantissa);
-
-    union float_to_unsigned_int_to_bytes {
+unsigned long FloatPacker::encode(float value, bool isSigned) const {
+    union {
         float f;
         unsigned int ui;
-        unsigned char ub[4];  // unsigned bytes
-    };
-
-    float_to_unsigned_int_to_bytes v;
-    v.ui = result;
-    return v.f;
+    } v;
+    v.f = value;
+
+    unsigned long sign = v.ui >> SIGN_SHIFT_32;
+    int exponent = (v.ui & EXPONENT_MASK_32) >> MANTISSA_BITS_32;
+    unsigned long mantissa = v.ui & MANTISSA_MASK_32;
+
+    if ((exponent == 0 && mantissa == 0) || (sign && !isSigned))
+        return 0;
+
+    int maxExponent = (1 << _exponentBits) - 1;
+    if (exponent == 0xff) {
+        exponent = maxExponent;
+        mantissa = _mantissa_mask;
+    } else {
+        // Round to nearest, a carry increments the exponent
+        unsigned long shift = MANTISSA_BITS_32 - _mantissaBits;
+        if (shift) {
+            mantissa += 1UL << (shift - 1);
+            if (mantissa >> MANTISSA_BITS_32) {
+                mantissa = 0;
+                exponent++;
+            }
+            mantissa >>= shift;
+        }
+        // Inverse of the exponent mapping of decode()
+        exponent -= _exponent_min + EXPONENT_BIAS_32;
+        if (exponent < 0)
+            return 0;
+        if (exponent > maxExponent) {
+            exponent = maxExponent;
+            mantissa = _mantissa_mask;
+        }
+    }
+    unsigned long result = (static_cast<unsigned long>(exponent) << _mantissaBits) | mantissa;
+    return isSigned ? (sign << _sign_shift) | result : result;
 }
 
 }  // namespace FITools
@@ -1,5 +1,6 @@
 #include <xiot/FIConstants.h>
 #include <xiot/FIEncodingAlgorithms.h>
+#include <xiot/X3DFICodecRegistry.h>
 #include <xiot/X3DFIEncoder.h>
 #include <xiot/X3DFIEncodingAlgorithms.h>
 
@@ -11,6 +12,9 @@ X3DFIEncoder::X3DFIEncoder(void)
     : FIEncoder(),
       _floatAlgorithm(FI::FloatEncodingAlgorithm::ALGORITHM_ID),
       _intAlgorithm(DeltazlibIntArrayAlgorithm::ALGORITHM_ID) {
+    // The attribute values of the X3D vocabulary, see X3DParserVocabulary
+    _initialAttributeValues.push_back("false");
+    _initialAttributeValues.push_back("true");
     reset();
 }
 
@@ -33,36 +37,93 @@ int X3DFIEncoder::getIntAlgorithm() const {
     return _intAlgorithm;
 }
 
+void X3DFIEncoder::setFloatQuantization(const FloatQuantization &quantization) {
+    _codecSettings.floatQuantization = quantization;
+}
+
+const FloatQuantization &X3DFIEncoder::getFloatQuantization() const {
+    return _codecSettings.floatQuantization;
+}
+
+void X3DFIEncoder::setParallelCompression(const ParallelCompression &parallel) {
+    _codecSettings.parallelCompression = parallel;
+}
+
+const ParallelCompression &X3DFIEncoder::getParallelCompression() const {
+    return _codecSettings.parallelCompression;
+}
+
+void X3DFIEncoder::setMeshCompression(const MeshCompression &mesh) {
+    _meshCompression = mesh;
+}
+
+const MeshCompression &X3DFIEncoder::getMeshCompression() const {
+    return _meshCompression;
+}
 
 void X3DFIEncoder::encodeAttributeFloatArray(const float *values, size_t size) {
+    encodeAttributeFloatArray(values, size, 1);
+}
+
+void X3DFIEncoder::encodeAttributeFloatArray(const float *values, size_t size, unsigned int stride) {
     // We want to start at position 3
-    assert(_currentBytePos == 2);
+    assert(getCurrentBytePos() == 2);
 
     if (_floatAlgorithm == FI::FloatEncodingAlgorithm::ALGORITHM_ID || size < 15) {
         FIEncoder::encodeAttributeFloatArray(values, size);
         return;
     }
 
-    encodeEncodingAlgorithmStart(QuantizedzlibFloatArrayAlgorithm::ALGORITHM_ID);
+    const X3DFICodecRegistry &registry = X3DFICodecRegistry::getInstance();
+    const X3DFICodec *codec = registry.findByID(_floatAlgorithm);
+    if (!codec || !codec->encodeFloatArray)
+        codec = registry.findByID(QuantizedzlibFloatArrayAlgorithm::ALGORITHM_ID);
 
+    CodecSettings settings(_codecSettings);
+    settings.stride = stride;
     FI::NonEmptyOctetString octets;
-    QuantizedzlibFloatArrayAlgorithm::encode(values, size, octets);
+    encodeEncodingAlgorithmStart(codec->algorithmID);
+    codec->encodeFloatArray(values, size, octets, settings);
     encodeNonEmptyByteString5(octets);
 }
 
 void X3DFIEncoder::encodeAttributeIntegerArray(const int *values, size_t size) {
     // We want to start at position 3
-    assert(_currentBytePos == 2);
+    assert(getCurrentBytePos() == 2);
 
     if (_intAlgorithm == FI::IntEncodingAlgorithm::ALGORITHM_ID || size < 15) {
         FIEncoder::encodeAttributeIntegerArray(values, size);
         return;
     }
 
-    encodeEncodingAlgorithmStart(DeltazlibIntArrayAlgorithm::ALGORITHM_ID);
+    const X3DFICodecRegistry &registry = X3DFICodecRegistry::getInstance();
+    const X3DFICodec *codec = registry.findByID(_intAlgorithm);
+    if (!codec || !codec->encodeIntArray)
+        codec = registry.findByID(DeltazlibIntArrayAlgorithm::ALGORITHM_ID);
+
+    FI::NonEmptyOctetString octets;
+    encodeEncodingAlgorithmStart(codec->algorithmID);
+    codec->encodeIntArray(values, size, octets, _codecSettings);
+    encodeNonEmptyByteString5(octets);
+}
+
+void X3DFIEncoder::encodeAttributeMeshIndex(const int *values, size_t size) {
+    // We want to start at position 3
+    assert(getCurrentBytePos() == 2);
+
+    FI::NonEmptyOctetString octets;
+    encodeEncodingAlgorithmStart(MeshIndexAlgorithm::ALGORITHM_ID);
+    MeshIndexAlgorithm::encode(values, size, octets);
+    encodeNonEmptyByteString5(octets);
+}
+
+void X3DFIEncoder::encodeAttributeMeshCoordinate(const float *values, size_t size, const std::vector<int> &index, unsigned int faceSize) {
+    // We want to start at position 3
+    assert(getCurrentBytePos() == 2);
 
     FI::NonEmptyOctetString octets;
-    DeltazlibIntArrayAlgorithm::encode(values, size, octets);
+    encodeEncodingAlgorithmStart(MeshCoordinateAlgorithm::ALGORITHM_ID);
+    MeshCoordinateAlgorithm::encode(values, size, index, faceSize, _meshCompression.coordinateBits, octets);
     encodeNonEmptyByteString5(octets);
 }
 
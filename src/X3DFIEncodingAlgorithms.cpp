@@ -1,7 +1,12 @@
 #include <xiot/X3DFIEncodingAlgorithms.h>
 
+#include <algorithm>
+#include <cfloat>
+#include <climits>
 #include <cmath>
+#include <cstring>
 #include <iostream>
+#include <sstream>
 
 #include "zlib.h"
 
@@ -12,7 +17,518 @@
 
 namespace XIOT {
 
-std::string QuantizedzlibFloatArrayAlgorithm::decodeToString(const FI::NonEmptyOctetString &octets) const {
+namespace {
+
+template <unsigned int NUM_BITS>
+void unpackFloats(FITools::BitUnpacker &bu, const FITools::FloatPacker &fp, bool sign, float *result, size_t count) {
+    for (size_t i = 0; i < count; i++)
+        result[i] = fp.decode(bu.unpack(NUM_BITS), sign);
+}
+
+/// Unpacks count floats, with fixed width loops for the common widths
+void unpackFloats(FITools::BitUnpacker &bu, const FITools::FloatPacker &fp, int numBits, bool sign, float *result, size_t count) {
+    switch (numBits) {
+        case 32:
+            unpackFloats<32>(bu, fp, sign, result, count);
+            break;
+        case 24:
+            unpackFloats<24>(bu, fp, sign, result, count);
+            break;
+        case 16:
+            unpackFloats<16>(bu, fp, sign, result, count);
+            break;
+        default:
+            for (size_t i = 0; i < count; i++)
+                result[i] = fp.decode(bu.unpack(numBits), sign);
+    }
+}
+
+/**
+ * Appends the header of 5.4.3 and the compressed data. flags is 0x80 for
+ * values without sign bit.
+ */
+void appendQuantizedArray(FI::NonEmptyOctetString &octets, unsigned char flags, int exponentBits, int mantissaBits,
+                          size_t numFloats, const unsigned char *data, size_t length,
+                          const ParallelCompression &parallel = ParallelCompression()) {
+    // Compress the data
+    std::vector<unsigned char> compressedData;
+    if (!FITools::compress(data, length, compressedData, Z_DEFAULT_COMPRESSION, parallel.threads, parallel.blockSize)) {
+        throw X3DParseException("Error while encoding QuantizedzlibFloatArrayAlgorithm");
+    }
+
+    // Put the number of bits for exponent and mantissa
+    octets.push_back(static_cast<unsigned char>(flags | exponentBits));
+    octets.push_back(static_cast<unsigned char>(mantissaBits));
+
+    // Put the length and the number of floats
+    unsigned int header[2] = {static_cast<unsigned int>(length), static_cast<unsigned int>(numFloats)};
+    size_t offset = octets.size();
+    octets.resize(offset + 8);
+    FI::Tools::swapBytes4(reinterpret_cast<const unsigned char *>(header), 2, &octets[offset]);
+
+    octets.insert(octets.end(), compressedData.begin(), compressedData.end());
+}
+
+/// Returns the exponent of a finite, non zero value after rounding to mantissaBits, or INT_MIN
+int roundedExponent(float value, int mantissaBits) {
+    union {
+        float f;
+        unsigned int ui;
+    } v;
+    v.f = value;
+    int exponent = (v.ui >> 23) & 0xff;
+    unsigned int mantissa = v.ui & 0x7fffff;
+    if (exponent == 0xff || (exponent == 0 && mantissa == 0))
+        return INT_MIN;
+    int shift = 23 - mantissaBits;
+    if (shift && ((mantissa + (1u << (shift - 1))) >> 23))
+        exponent++;
+    return exponent - 127;
+}
+
+/// Derives the bits of the encoding from the quantization and the values
+void deriveBits(const float *values, size_t size, const FloatQuantization &quantization, int &exponentBits, int &mantissaBits, bool &isSigned) {
+    isSigned = false;
+    float maxValue = 0;
+    for (size_t i = 0; i < size; i++) {
+        if (values[i] < 0)
+            isSigned = true;
+        if (fabs(values[i]) > maxValue && fabs(values[i]) <= FLT_MAX)
+            maxValue = fabs(values[i]);
+    }
+
+    switch (quantization.mode) {
+        case FloatQuantization::BITS:
+            exponentBits = quantization.exponentBits;
+            mantissaBits = quantization.mantissaBits;
+            return;
+        case FloatQuantization::RELATIVE_ERROR:
+            // Rounding to nearest errs by at most half a unit of the last place
+            mantissaBits = quantization.maxError > 0 ? static_cast<int>(ceil(-log(quantization.maxError) / log(2.0))) - 1 : 23;
+            break;
+        case FloatQuantization::ABSOLUTE_ERROR: {
+            int maxExponent = 0;
+            frexp(maxValue, &maxExponent);
+            mantissaBits = quantization.maxError > 0 ? static_cast<int>(ceil(maxExponent - 2 - log(quantization.maxError) / log(2.0))) : 23;
+            break;
+        }
+        default:
+            exponentBits = 8;
+            mantissaBits = 23;
+            return;
+    }
+    mantissaBits = std::max(0, std::min(23, mantissaBits));
+
+    // The smallest exponent bits covering all values, decoding maps the
+    // exponent field e to e - 2^(exponentBits - 1). The field 0 is kept
+    // free as the value 0 is encoded as all bits 0.
+    int minExponent = INT_MAX, maxExponent = INT_MIN;
+    for (size_t i = 0; i < size; i++) {
+        if (quantization.mode == FloatQuantization::ABSOLUTE_ERROR && fabs(values[i]) <= quantization.maxError)
+            continue;
+        int exponent = roundedExponent(values[i], mantissaBits);
+        if (exponent == INT_MIN)
+            continue;
+        minExponent = std::min(minExponent, exponent);
+        maxExponent = std::max(maxExponent, exponent);
+    }
+    exponentBits = 1;
+    while (exponentBits < 8 && minExponent != INT_MAX &&
+           (minExponent + (1 << (exponentBits - 1)) < 1 || maxExponent > (1 << (exponentBits - 1)) - 1))
+        exponentBits++;
+}
+
+const unsigned char BLOCK_FLOAT_ARRAY = 0;
+const unsigned char BLOCK_INT_ARRAY = 1;
+/// Type, span, number of values and values per block
+const size_t BLOCK_HEADER_SIZE = 10;
+
+void appendUInt(FI::NonEmptyOctetString &octets, unsigned int value) {
+    for (int shift = 24; shift >= 0; shift -= 8)
+        octets.push_back(static_cast<unsigned char>(value >> shift));
+}
+
+struct BlockEncodeJob {
+    const unsigned char *words;
+    size_t size;
+    size_t valuesPerBlock;
+    std::vector<std::vector<unsigned char> > blocks;
+    std::vector<char> failed;
+};
+
+void compressBlock(void *context, size_t block) {
+    BlockEncodeJob &job = *static_cast<BlockEncodeJob *>(context);
+    size_t begin = block * job.valuesPerBlock;
+    size_t count = std::min(job.valuesPerBlock, job.size - begin);
+    job.failed[block] = !FITools::compress(job.words + begin * 4, count * 4, job.blocks[block], Z_DEFAULT_COMPRESSION);
+}
+
+/// Compresses the big-endian words block by block and appends the array
+void appendBlocks(FI::NonEmptyOctetString &octets, unsigned char type, unsigned char span, const std::vector<unsigned char> &words,
+                  size_t valuesPerBlock, const ParallelCompression &parallel) {
+    BlockEncodeJob job;
+    job.words = words.empty() ? NULL : &words.front();
+    job.size = words.size() / 4;
+    job.valuesPerBlock = valuesPerBlock;
+    size_t numBlocks = (job.size + valuesPerBlock - 1) / valuesPerBlock;
+    job.blocks.resize(numBlocks);
+    job.failed.resize(numBlocks);
+
+    FITools::parallelFor(numBlocks, parallel.threads, compressBlock, &job);
+    if (std::find(job.failed.begin(), job.failed.end(), 1) != job.failed.end())
+        throw X3DParseException("Error while encoding BlockzlibArrayAlgorithm");
+
+    octets.push_back(type);
+    octets.push_back(span);
+    appendUInt(octets, static_cast<unsigned int>(job.size));
+    appendUInt(octets, static_cast<unsigned int>(valuesPerBlock));
+    unsigned int end = 0;
+    for (size_t i = 0; i < numBlocks; i++) {
+        end += static_cast<unsigned int>(job.blocks[i].size());
+        appendUInt(octets, end);
+    }
+    for (size_t i = 0; i < numBlocks; i++)
+        octets.insert(octets.end(), job.blocks[i].begin(), job.blocks[i].end());
+}
+
+/// The header of a BlockzlibArrayAlgorithm array
+struct BlockLayout {
+    BlockLayout(const FI::OctetString &octets) {
+        if (octets.size() < BLOCK_HEADER_SIZE)
+            throw X3DParseException("Invalid BlockzlibArrayAlgorithm data");
+        const unsigned char *p = &octets.front();
+        type = p[0];
+        span = p[1];
+        length = FI::Tools::readUInt(p + 2);
+        valuesPerBlock = FI::Tools::readUInt(p + 6);
+        numBlocks = valuesPerBlock ? (length + valuesPerBlock - 1) / valuesPerBlock : 0;
+        if ((length && !valuesPerBlock) || numBlocks > (octets.size() - BLOCK_HEADER_SIZE) / 4)
+            throw X3DParseException("Invalid BlockzlibArrayAlgorithm data");
+        ends = p + BLOCK_HEADER_SIZE;
+        data = ends + numBlocks * 4;
+        dataSize = octets.size() - BLOCK_HEADER_SIZE - numBlocks * 4;
+        // Every block has to be inside the data, not only the last one
+        size_t previous = 0;
+        for (size_t i = 0; i < numBlocks; i++) {
+            size_t end = FI::Tools::readUInt(ends + i * 4);
+            if (end < previous || end > dataSize)
+                throw X3DParseException("Invalid BlockzlibArrayAlgorithm data");
+            previous = end;
+        }
+    }
+
+    unsigned char type;
+    unsigned char span;
+    size_t length;
+    size_t valuesPerBlock;
+    size_t numBlocks;
+    const unsigned char *ends;
+    const unsigned char *data;
+    size_t dataSize;
+};
+
+struct BlockDecodeJob {
+    BlockDecodeJob(const BlockLayout &blockLayout) : layout(blockLayout){};
+
+    const BlockLayout &layout;
+    size_t first;
+    size_t count;
+    /// count values of 4 octets, float or int
+    unsigned char *result;
+    std::vector<char> failed;
+};
+
+void uncompressBlock(void *context, size_t index) {
+    BlockDecodeJob &job = *static_cast<BlockDecodeJob *>(context);
+    const BlockLayout &layout = job.layout;
+    size_t block = job.first / layout.valuesPerBlock + index;
+    size_t begin = block * layout.valuesPerBlock;
+    size_t count = std::min(layout.valuesPerBlock, layout.length - begin);
+
+    size_t dataBegin = block ? FI::Tools::readUInt(layout.ends + (block - 1) * 4) : 0;
+    size_t dataEnd = FI::Tools::readUInt(layout.ends + block * 4);
+    std::vector<unsigned char> bytes(count * 4);
+    uLongf destSize = static_cast<uLongf>(bytes.size());
+    if (uncompress(&bytes.front(), &destSize, layout.data + dataBegin, static_cast<uLong>(dataEnd - dataBegin)) != Z_OK ||
+        destSize != bytes.size()) {
+        job.failed[index] = 1;
+        return;
+    }
+
+    std::vector<unsigned int> words(count);
+    FI::Tools::swapBytes4(&bytes.front(), count, reinterpret_cast<unsigned char *>(&words.front()));
+    if (layout.span) {
+        for (size_t i = layout.span; i < count; i++)
+            words[i] += words[i - layout.span];
+    }
+
+    // Copy the part of the block that is in the range
+    size_t from = std::max(begin, job.first);
+    size_t to = std::min(begin + count, job.first + job.count);
+    memcpy(job.result + (from - job.first) * 4, &words[from - begin], (to - from) * 4);
+}
+
+/// Decodes the range of 4 octet values to result, resized to the clipped range
+template <class T>
+void decodeBlocks(const FI::OctetString &octets, unsigned char type, std::vector<T> &vec, size_t first, size_t count, int threads) {
+    BlockLayout layout(octets);
+    if (layout.type != type) {
+        throw X3DParseException(type == BLOCK_FLOAT_ARRAY ? "BlockzlibArrayAlgorithm: The array contains ints, not floats"
+                                                          : "BlockzlibArrayAlgorithm: The array contains floats, not ints");
+    }
+    first = std::min(first, layout.length);
+    count = std::min(count, layout.length - first);
+
+    std::vector<T> result(count);
+    if (count) {
+        BlockDecodeJob job(layout);
+        job.first = first;
+        job.count = count;
+        job.result = reinterpret_cast<unsigned char *>(&result.front());
+        size_t numBlocks = (first + count - 1) / layout.valuesPerBlock - first / layout.valuesPerBlock + 1;
+        job.failed.resize(numBlocks);
+
+        FITools::parallelFor(numBlocks, threads, uncompressBlock, &job);
+        if (std::find(job.failed.begin(), job.failed.end(), 1) != job.failed.end())
+            throw X3DParseException("Error while decoding BlockzlibArrayAlgorithm");
+    }
+    std::swap(result, vec);
+}
+
+/// The values of a block, at least 1024
+size_t getValuesPerBlock(const ParallelCompression &parallel) {
+    return std::max(parallel.blockSize / 4, static_cast<size_t>(1024));
+}
+
+const int MESH_CACHE_SIZE = 32;
+const unsigned char MESH_CODE_END = 0;
+const unsigned char MESH_CODE_NEW = 1;
+const unsigned char MESH_CODE_CACHE = 2;
+const unsigned char MESH_CODE_EXPLICIT = 255;
+/// Face size, bits, number of points, minimum and grid size
+const size_t MESH_COORDINATE_HEADER_SIZE = 22;
+
+inline unsigned int zigzag(int value) {
+    return (static_cast<unsigned int>(value) << 1) ^ static_cast<unsigned int>(-static_cast<int>(static_cast<unsigned int>(value) >> 31));
+}
+
+inline int unzigzag(unsigned int value) {
+    return static_cast<int>(value >> 1) ^ -static_cast<int>(value & 1);
+}
+
+void appendFloat(FI::NonEmptyOctetString &octets, float value) {
+    union {
+        float f;
+        unsigned int ui;
+    } v;
+    v.f = value;
+    appendUInt(octets, v.ui);
+}
+
+float readFloat(const unsigned char *bytes) {
+    union {
+        float f;
+        unsigned int ui;
+    } v;
+    v.ui = FI::Tools::readUInt(bytes);
+    return v.f;
+}
+
+/// Splits the words into four byte planes, the most significant first
+void appendPlanes(std::vector<unsigned char> &planes, const std::vector<unsigned int> &words) {
+    size_t size = words.size();
+    planes.resize(size * 4);
+    for (size_t i = 0; i < size; i++) {
+        planes[i] = static_cast<unsigned char>(words[i] >> 24);
+        planes[size + i] = static_cast<unsigned char>(words[i] >> 16);
+        planes[2 * size + i] = static_cast<unsigned char>(words[i] >> 8);
+        planes[3 * size + i] = static_cast<unsigned char>(words[i]);
+    }
+}
+
+/// The move-to-front list of the MeshIndexAlgorithm
+class VertexCache {
+  public:
+    VertexCache() : _size(0){};
+
+    int find(int vertex) const {
+        for (int i = 0; i < _size; i++) {
+            if (_vertices[i] == vertex)
+                return i;
+        }
+        return -1;
+    };
+
+    int get(int position) const { return _vertices[position]; };
+    int size() const { return _size; };
+
+    void moveToFront(int vertex) {
+        int i = find(vertex);
+        if (i < 0)
+            i = _size < MESH_CACHE_SIZE ? _size++ : MESH_CACHE_SIZE - 1;
+        for (; i > 0; i--)
+            _vertices[i] = _vertices[i - 1];
+        _vertices[0] = vertex;
+    };
+
+  private:
+    int _vertices[MESH_CACHE_SIZE];
+    int _size;
+};
+
+/**
+ * Visits the points of a mesh in the order of their first use in the index
+ * and predicts each one from the points visited before it, see
+ * MeshCoordinateAlgorithm.
+ */
+class MeshPredictor {
+  public:
+    MeshPredictor(const std::vector<int> &index, unsigned int faceSize, size_t numPoints, unsigned int maxValue)
+        : _index(index), _faceSize(faceSize), _numPoints(numPoints), _maxValue(maxValue), _head(numPoints, -1){};
+
+    /**
+	 * Calls visitor(point, prediction) once for each point. When the visitor
+	 * returns, the quantized point has to be set in points.
+	 */
+    template <class Visitor>
+    void run(std::vector<unsigned int> &points, Visitor &visitor) {
+        std::vector<char> visited(_numPoints, 0);
+        std::vector<int> face;
+        int last = -1;
+        unsigned int prediction[3];
+        for (size_t i = 0; i < _index.size(); i++) {
+            int point = _index[i];
+            if (!_faceSize && point == -1) {
+                face.clear();
+                continue;
+            }
+            // Invalid points are left out of the face
+            if (point >= 0 && static_cast<size_t>(point) < _numPoints) {
+                face.push_back(point);
+                size_t k = face.size() - 1;
+                if (!visited[point]) {
+                    predict(points, face, last, prediction);
+                    visitor(point, prediction);
+                    visited[point] = 1;
+                    last = point;
+                }
+                if (k >= 2)
+                    addTriangle(face[0], face[k - 1], face[k]);
+            }
+            if (_faceSize && (i + 1) % _faceSize == 0)
+                face.clear();
+        }
+
+        // Points not used by the index
+        for (size_t point = 0; point < _numPoints; point++) {
+            if (!visited[point]) {
+                for (int d = 0; d < 3; d++)
+                    prediction[d] = last == -1 ? 0 : points[3 * last + d];
+                visitor(point, prediction);
+                last = static_cast<int>(point);
+            }
+        }
+    };
+
+  private:
+    void predict(const std::vector<unsigned int> &points, const std::vector<int> &face, int last, unsigned int prediction[3]) const {
+        size_t k = face.size() - 1;
+        int neighbour = k == 0 ? last : k == 1 ? face[0] : face[k - 1];
+        if (k >= 2) {
+            // The parallelogram across the edge the point faces
+            int a = face[0], b = face[k - 1];
+            int c = a != b ? findOpposite(a, b) : -1;
+            if (c != -1) {
+                for (int d = 0; d < 3; d++) {
+                    long long value = static_cast<long long>(points[3 * a + d]) + points[3 * b + d] - points[3 * c + d];
+                    prediction[d] = static_cast<unsigned int>(std::min(std::max(value, 0LL), static_cast<long long>(_maxValue)));
+                }
+                return;
+            }
+        }
+        for (int d = 0; d < 3; d++)
+            prediction[d] = neighbour == -1 ? 0 : points[3 * neighbour + d];
+    };
+
+    void addTriangle(int a, int b, int c) {
+        addEdge(a, b, c);
+        addEdge(b, c, a);
+        addEdge(c, a, b);
+    };
+
+    /// Stores the edge at its lower point, a later triangle replaces the opposite point
+    void addEdge(int a, int b, int opposite) {
+        if (a == b)
+            return;
+        int low = std::min(a, b), high = std::max(a, b);
+        for (int e = _head[low]; e != -1; e = _edges[e].next) {
+            if (_edges[e].other == high) {
+                _edges[e].opposite = opposite;
+                return;
+            }
+        }
+        Edge edge = {high, opposite, _head[low]};
+        _head[low] = static_cast<int>(_edges.size());
+        _edges.push_back(edge);
+    };
+
+    int findOpposite(int a, int b) const {
+        int low = std::min(a, b), high = std::max(a, b);
+        for (int e = _head[low]; e != -1; e = _edges[e].next) {
+            if (_edges[e].other == high)
+                return _edges[e].opposite;
+        }
+        return -1;
+    };
+
+    struct Edge {
+        int other;
+        int opposite;
+        int next;
+    };
+
+    const std::vector<int> &_index;
+    unsigned int _faceSize;
+    size_t _numPoints;
+    unsigned int _maxValue;
+    /// The first edge of each point, -1 for none
+    std::vector<int> _head;
+    std::vector<Edge> _edges;
+};
+
+/// Collects the differences of the quantized points to their predictions
+struct ResidualWriter {
+    ResidualWriter(const std::vector<unsigned int> &quantized, std::vector<unsigned int> &result) : points(quantized), residuals(result){};
+
+    void operator()(size_t point, const unsigned int prediction[3]) {
+        for (int d = 0; d < 3; d++)
+            residuals.push_back(zigzag(static_cast<int>(points[3 * point + d] - prediction[d])));
+    };
+
+    const std::vector<unsigned int> &points;
+    std::vector<unsigned int> &residuals;
+};
+
+/// Adds the differences from the byte planes to the predictions
+struct ResidualReader {
+    ResidualReader(const unsigned char *planes, size_t count, std::vector<unsigned int> &result) : p(planes), size(count), next(0), points(result){};
+
+    void operator()(size_t point, const unsigned int prediction[3]) {
+        for (int d = 0; d < 3; d++, next++) {
+            unsigned int word = (static_cast<unsigned int>(p[next]) << 24) | (p[size + next] << 16) | (p[2 * size + next] << 8) | p[3 * size + next];
+            points[3 * point + d] = prediction[d] + static_cast<unsigned int>(unzigzag(word));
+        }
+    };
+
+    const unsigned char *p;
+    size_t size;
+    size_t next;
+    std::vector<unsigned int> &points;
+};
+
+}  // namespace
+
+std::string QuantizedzlibFloatArrayAlgorithm::decodeToString(const FI::OctetString &octets) const {
     std::vector<float> floatArray;
     QuantizedzlibFloatArrayAlgorithm::decodeToFloatArray(octets, floatArray);
 
@@ -25,7 +541,7 @@ std::string QuantizedzlibFloatArrayAlgorithm::decodeToString(const FI::NonEmptyO
     return ss.str();
 }
 
-void QuantizedzlibFloatArrayAlgorithm::decodeToFloatArray(const FI::NonEmptyOctetString &octets, std::vector<float> &vec) {
+void QuantizedzlibFloatArrayAlgorithm::decodeToFloatArray(const FI::OctetString &octets, std::vector<float> &vec) {
     // The format for encoding the custom float format is : (-S)000EEEE|000MMMMM.
     bool sign = (octets[0] & 0x80) == 0;
     unsigned char exponent = octets[0] & FI::Constants::LAST_FOUR_BITS;
@@ -35,100 +551,136 @@ void QuantizedzlibFloatArrayAlgorithm::decodeToFloatArray(const FI::NonEmptyOcte
 
     const unsigned char *pStr = &octets.front();
 
-    unsigned int len = FI::Tools::readUInt(pStr + 2);
     unsigned int numFloats = FI::Tools::readUInt(pStr + 6);  // = (len * 8) / (exponent + mantissa + sign);
 
-    std::vector<Bytef> temp_result(len);
-    uLong sourceLen = static_cast<uLong>(octets.size() - 10);
-    uLong destSize = static_cast<uLong>(temp_result.size());
+    // Inflate in chunks and unpack the floats of each chunk directly into
+    // the result. The octets of a float split across chunks are moved to
+    // the front of the chunk before inflating the next one.
+    unsigned int len = FI::Tools::readUInt(pStr + 2);
+    const size_t CHUNK_SIZE = std::min<size_t>(64 * 1024, len + 8);
+    std::vector<unsigned char> buffer(CHUNK_SIZE);
+    unsigned char *chunk = &buffer.front();
+    size_t filled = 0;
+    unsigned int firstBit = 0;
 
-    int result_code = uncompress(&temp_result.front(), &destSize, (unsigned char *)pStr + 10, sourceLen);
-    if (result_code != Z_OK) {
+    z_stream stream;
+    memset(&stream, 0, sizeof(stream));
+    stream.next_in = const_cast<Bytef *>(pStr + 10);
+    stream.avail_in = static_cast<uInt>(octets.size() - 10);
+    if (inflateInit(&stream) != Z_OK)
+        throw X3DParseException("Error while decoding QuantizedzlibFloatArray. Could not initialize ZLIB.");
+
+    vec.resize(numFloats);
+    float *result = numFloats ? &vec.front() : NULL;
+    FITools::FloatPacker fp(exponent, mantissa);
+    size_t decoded = 0;
+    int result_code = Z_OK;
+    while (decoded < numFloats) {
+        stream.next_out = chunk + filled;
+        stream.avail_out = static_cast<uInt>(CHUNK_SIZE - filled);
+        result_code = inflate(&stream, Z_NO_FLUSH);
+        if (result_code != Z_OK && result_code != Z_STREAM_END)
+            break;
+        filled = CHUNK_SIZE - stream.avail_out;
+
+        size_t count = numBits ? (filled * 8 - firstBit) / numBits : numFloats;
+        if (count > numFloats - decoded)
+            count = numFloats - decoded;
+        if (!count && result_code == Z_STREAM_END)
+            break;
+
+        FITools::BitUnpacker bu(chunk, filled, firstBit);
+        unpackFloats(bu, fp, numBits, sign, result + decoded, count);
+        decoded += count;
+
+        size_t position = bu.getBitPosition();
+        memmove(chunk, chunk + position / 8, filled - position / 8);
+        filled -= position / 8;
+        firstBit = position % 8;
+    }
+    inflateEnd(&stream);
+
+    if (decoded < numFloats) {
         std::stringstream ss;
         ss << "Error while decoding QuantizedzlibFloatArray. ZLIB error code: " << result_code;
         throw X3DParseException(ss.str());
     }
-
-    std::vector<float> result(numFloats);
-
-    FITools::BitUnpacker bu(&temp_result.front(), destSize);
-    FITools::FloatPacker fp(exponent, mantissa);
-    for (unsigned int i = 0; i < numFloats; i++) {
-        unsigned long val = bu.unpack(numBits);
-        result[i] = fp.decode(val, sign);
-    }
-    std::swap(result, vec);
 }
 
 void QuantizedzlibFloatArrayAlgorithm::encode(const float *values, size_t size, FI::NonEmptyOctetString &octets) {
-    unsigned char *bytes = new unsigned char[size * 4];
-    unsigned char *bytepos = bytes;
-    size_t i;
+    encode(values, size, octets, FloatQuantization());
+}
 
-    const float *vf = values;
-    for (i = 0; i < size; i++) {
-        union float_to_unsigned_int_to_bytes {
-            float f;
-            unsigned int ui;
-            unsigned char ub[4];  // unsigned bytes
-        };
-        float_to_unsigned_int_to_bytes v;
-        v.f = (*vf) * 2.0f;
+void QuantizedzlibFloatArrayAlgorithm::encode(const float *values, size_t size, FI::NonEmptyOctetString &octets, const FloatQuantization &quantization,
+                                              const ParallelCompression &parallel) {
+    if (quantization.mode == FloatQuantization::LOSSLESS) {
+        std::vector<unsigned char> bytes(size * 4);
+        for (size_t i = 0; i < size; i++) {
+            union float_to_unsigned_int_to_bytes {
+                float f;
+                unsigned int ui;
+                unsigned char ub[4];  // unsigned bytes
+            };
+            float_to_unsigned_int_to_bytes v;
+            // The exponent field is one above the IEEE exponent, see FloatPacker
+            v.f = values[i] * 2.0f;
 
-        // Avoid -0
-        if (v.ui == 0x80000000) {
-            v.f = 0.0f;
+            // Avoid -0
+            if (v.ui == 0x80000000) {
+                v.f = 0.0f;
+            }
+            bytes[4 * i] = v.ub[3];
+            bytes[4 * i + 1] = v.ub[2];
+            bytes[4 * i + 2] = v.ub[1];
+            bytes[4 * i + 3] = v.ub[0];
         }
-        // std::cout << "value: " << v << " bytes: " << (int)s[0] << " " << (int)s[1] << " " << (int)s[2] << " " << (int)s[3]) << std::endl;
-        *bytepos++ = v.ub[3];
-        *bytepos++ = v.ub[2];
-        *bytepos++ = v.ub[1];
-        *bytepos++ = v.ub[0];
-        vf++;
+        appendQuantizedArray(octets, 0, 8, 23, size, bytes.empty() ? NULL : &bytes.front(), bytes.size(), parallel);
+        return;
     }
 
+    int exponentBits, mantissaBits;
+    bool isSigned;
+    deriveBits(values, size, quantization, exponentBits, mantissaBits, isSigned);
 
-    // Compress the data
-    unsigned long compressedSize = static_cast<unsigned long>(size * 4) + static_cast<unsigned long>(ceil((size * 4) * 0.001)) + 12;
-    Bytef *compressedData = new Bytef[compressedSize];
-
-    // Call zlib's compress function.
-    if (compress2(compressedData, &compressedSize, reinterpret_cast<const Bytef *>(bytes), static_cast<unsigned long>(size * 4), Z_DEFAULT_COMPRESSION) != Z_OK) {
-        throw X3DParseException("Error while encoding QuantizedzlibFloatArrayAlgorithm");
+    FITools::FloatPacker fp(exponentBits, mantissaBits);
+    FITools::BitPacker bp;
+    unsigned int numBits = exponentBits + mantissaBits + (isSigned ? 1 : 0);
+    bool flushSmall = quantization.mode == FloatQuantization::ABSOLUTE_ERROR;
+    for (size_t i = 0; i < size; i++) {
+        if (flushSmall && fabs(values[i]) <= quantization.maxError)
+            bp.pack(0, numBits);
+        else
+            bp.pack(fp.encode(values[i], isSigned), numBits);
     }
 
-    unsigned char *s;
-    // Put the number of bits for exponent
-    octets.push_back(static_cast<unsigned char>(8));
-    // Put the number of bits for mantissa
-    octets.push_back(static_cast<unsigned char>(23));
+    const std::vector<unsigned char> &packed = bp.getResult();
+    appendQuantizedArray(octets, isSigned ? 0 : 0x80, exponentBits, mantissaBits, size, packed.empty() ? NULL : &packed.front(), packed.size(),
+                         parallel);
+}
 
-    // Put the length
-    int length = static_cast<int>(size * 4);
-    int length_reversed = FI::Tools::reverseBytes(&length);
-    s = reinterpret_cast<unsigned char *>(&length_reversed);
-    for (int i = 0; i < 4; i++) {
-        octets.push_back(s[i]);
-    }
+FloatQuantization FloatQuantization::fromBits(int exponentBits, int mantissaBits) {
+    FloatQuantization result;
+    result.mode = BITS;
+    result.exponentBits = exponentBits;
+    result.mantissaBits = mantissaBits;
+    return result;
+}
 
-    // Put the number of floats
-    int numFloats = static_cast<int>(size);
-    int numFloats_reversed = FI::Tools::reverseBytes(&numFloats);
-    ;
-    s = reinterpret_cast<unsigned char *>(&numFloats_reversed);
-    for (int i = 0; i < 4; i++) {
-        octets.push_back(s[i]);
-    }
+FloatQuantization FloatQuantization::fromRelativeError(float maxError) {
+    FloatQuantization result;
+    result.mode = RELATIVE_ERROR;
+    result.maxError = maxError;
+    return result;
+}
 
-    for (i = 0; i < compressedSize; i++) {
-        unsigned char c = compressedData[i];
-        octets.push_back(c);
-    }
-    delete[] compressedData;
-    delete[] bytes;
+FloatQuantization FloatQuantization::fromAbsoluteError(float maxError) {
+    FloatQuantization result;
+    result.mode = ABSOLUTE_ERROR;
+    result.maxError = maxError;
+    return result;
 }
 
-std::string DeltazlibIntArrayAlgorithm::decodeToString(const FI::NonEmptyOctetString &octets) const {
+std::string DeltazlibIntArrayAlgorithm::decodeToString(const FI::OctetString &octets) const {
     std::vector<int> intArray;
     DeltazlibIntArrayAlgorithm::decodeToIntArray(octets, intArray);
 
@@ -141,7 +693,7 @@ std::string DeltazlibIntArrayAlgorithm::decodeToString(const FI::NonEmptyOctetSt
     return ss.str();
 }
 
-void DeltazlibIntArrayAlgorithm::decodeToIntArray(const FI::NonEmptyOctetString &octets, std::vector<int> &vec) {
+void DeltazlibIntArrayAlgorithm::decodeToIntArray(const FI::OctetString &octets, std::vector<int> &vec) {
     const unsigned char *pStr = &octets.front();
 
     unsigned int length = FI::Tools::readUInt((unsigned char *)pStr);
@@ -170,7 +722,8 @@ void DeltazlibIntArrayAlgorithm::decodeToIntArray(const FI::NonEmptyOctetString
     std::swap(result, vec);
 }
 
-void DeltazlibIntArrayAlgorithm::encode(const int *values, size_t size, FI::NonEmptyOctetString &octets, bool isImage) {
+void DeltazlibIntArrayAlgorithm::encode(const int *values, size_t size, FI::NonEmptyOctetString &octets, bool isImage,
+                                        const ParallelCompression &parallel) {
     // compute delta
     char span = 0;
     size_t i = 0;
@@ -223,11 +776,8 @@ void DeltazlibIntArrayAlgorithm::encode(const int *values, size_t size, FI::NonE
         }
     }
 
-    unsigned long compressedSize = static_cast<unsigned long>(deltas.size() + ceil(deltas.size() * 0.001)) + 12;
-    Bytef *compressedData = new Bytef[compressedSize];
-
-    // Call zlib's compress function.
-    if (compress2(compressedData, &compressedSize, reinterpret_cast<const Bytef *>(&deltas[0]), static_cast<unsigned long>(deltas.size()), Z_DEFAULT_COMPRESSION) != Z_OK) {
+    std::vector<unsigned char> compressedData;
+    if (!FITools::compress(&deltas[0], deltas.size(), compressedData, Z_DEFAULT_COMPRESSION, parallel.threads, parallel.blockSize)) {
         throw X3DParseException("Error while encoding DeltazlibIntArrayAlgorithm");
     }
 
@@ -238,9 +788,438 @@ void DeltazlibIntArrayAlgorithm::encode(const int *values, size_t size, FI::NonE
     octets.insert(octets.begin(), s, s + 4);
     octets.push_back(span);
 
-    for (i = 0; i < compressedSize; i++) {
-        octets.push_back(compressedData[i]);
+    octets.insert(octets.end(), compressedData.begin(), compressedData.end());
+}
+
+std::string BlockzlibArrayAlgorithm::decodeToString(const FI::OctetString &octets) const {
+    std::stringstream ss;
+    if (isFloatArray(octets)) {
+        std::vector<float> floatArray;
+        decodeToFloatArray(octets, floatArray);
+        for (size_t i = 0; i < floatArray.size(); i++)
+            ss << (i ? " " : "") << floatArray[i];
+    } else {
+        std::vector<int> intArray;
+        decodeToIntArray(octets, intArray);
+        for (size_t i = 0; i < intArray.size(); i++)
+            ss << (i ? " " : "") << intArray[i];
+    }
+    return ss.str();
+}
+
+size_t BlockzlibArrayAlgorithm::getLength(const FI::OctetString &octets) {
+    return BlockLayout(octets).length;
+}
+
+bool BlockzlibArrayAlgorithm::isFloatArray(const FI::OctetString &octets) {
+    return BlockLayout(octets).type == BLOCK_FLOAT_ARRAY;
+}
+
+void BlockzlibArrayAlgorithm::decodeToFloatArray(const FI::OctetString &octets, std::vector<float> &vec, size_t first, size_t count, int threads) {
+    decodeBlocks(octets, BLOCK_FLOAT_ARRAY, vec, first, count, threads);
+}
+
+void BlockzlibArrayAlgorithm::decodeToIntArray(const FI::OctetString &octets, std::vector<int> &vec, size_t first, size_t count, int threads) {
+    decodeBlocks(octets, BLOCK_INT_ARRAY, vec, first, count, threads);
+}
+
+void BlockzlibArrayAlgorithm::encode(const float *values, size_t size, FI::NonEmptyOctetString &octets, const ParallelCompression &parallel) {
+    std::vector<unsigned char> words(size * 4);
+    if (size)
+        FI::Tools::swapBytes4(reinterpret_cast<const unsigned char *>(values), size, &words.front());
+    appendBlocks(octets, BLOCK_FLOAT_ARRAY, 0, words, getValuesPerBlock(parallel), parallel);
+}
+
+void BlockzlibArrayAlgorithm::encode(const int *values, size_t size, FI::NonEmptyOctetString &octets, const ParallelCompression &parallel) {
+    // The span is the size of the first face, as in DeltazlibIntArrayAlgorithm
+    unsigned char span = 4;
+    for (size_t i = 0; i < std::min(size, static_cast<size_t>(20)); i++) {
+        if (values[i] == -1) {
+            span = static_cast<unsigned char>(i + 1);
+            break;
+        }
+    }
+
+    // Deltas restart in each block
+    size_t valuesPerBlock = getValuesPerBlock(parallel);
+    std::vector<unsigned int> deltas(size);
+    for (size_t i = 0; i < size; i++) {
+        unsigned int value = static_cast<unsigned int>(values[i]);
+        deltas[i] = i % valuesPerBlock < span ? value : value - static_cast<unsigned int>(values[i - span]);
+    }
+
+    std::vector<unsigned char> words(size * 4);
+    if (size)
+        FI::Tools::swapBytes4(reinterpret_cast<const unsigned char *>(&deltas.front()), size, &words.front());
+    appendBlocks(octets, BLOCK_INT_ARRAY, span, words, valuesPerBlock, parallel);
+}
+
+std::string ShufflezlibFloatArrayAlgorithm::decodeToString(const FI::OctetString &octets) const {
+    std::vector<float> floatArray;
+    decodeToFloatArray(octets, floatArray);
+
+    std::stringstream ss;
+    for (size_t i = 0; i < floatArray.size(); i++)
+        ss << (i ? " " : "") << floatArray[i];
+    return ss.str();
+}
+
+size_t ShufflezlibFloatArrayAlgorithm::getLength(const FI::OctetString &octets) {
+    if (octets.size() < 5)
+        throw X3DParseException("Invalid ShufflezlibFloatArrayAlgorithm data");
+    return FI::Tools::readUInt(octets.data() + 1);
+}
+
+void ShufflezlibFloatArrayAlgorithm::decodeToFloatArray(const FI::OctetString &octets, std::vector<float> &vec) {
+    size_t length = getLength(octets);
+    unsigned int stride = octets[0];
+    if (!stride)
+        throw X3DParseException("Invalid ShufflezlibFloatArrayAlgorithm data");
+
+    std::vector<float> result(length);
+    if (length) {
+        std::vector<unsigned char> planes(length * 4);
+        uLongf destSize = static_cast<uLongf>(planes.size());
+        int result_code = uncompress(&planes.front(), &destSize, octets.data() + 5, static_cast<uLong>(octets.size() - 5));
+        if (result_code != Z_OK || destSize != planes.size()) {
+            std::stringstream ss;
+            ss << "Error while decoding ShufflezlibFloatArrayAlgorithm. ZLIB error code: " << result_code;
+            throw X3DParseException(ss.str());
+        }
+
+        // Join the byte planes and undo the prediction
+        const unsigned char *p0 = &planes.front();
+        const unsigned char *p1 = p0 + length;
+        const unsigned char *p2 = p1 + length;
+        const unsigned char *p3 = p2 + length;
+        unsigned int *words = reinterpret_cast<unsigned int *>(&result.front());
+        for (size_t i = 0; i < length; i++) {
+            unsigned int word = (static_cast<unsigned int>(p0[i]) << 24) | (p1[i] << 16) | (p2[i] << 8) | p3[i];
+            words[i] = i < stride ? word : word ^ words[i - stride];
+        }
+    }
+    std::swap(result, vec);
+}
+
+void ShufflezlibFloatArrayAlgorithm::encode(const float *values, size_t size, FI::NonEmptyOctetString &octets, unsigned int stride,
+                                            const ParallelCompression &parallel) {
+    if (stride < 1 || stride > 255)
+        throw X3DParseException("ShufflezlibFloatArrayAlgorithm: Stride out of range, min 1, max 255");
+
+    // Split the residuals of the prediction into byte planes
+    std::vector<unsigned char> planes(size * 4);
+    const unsigned int *words = reinterpret_cast<const unsigned int *>(values);
+    for (size_t i = 0; i < size; i++) {
+        unsigned int word = i < stride ? words[i] : words[i] ^ words[i - stride];
+        planes[i] = static_cast<unsigned char>(word >> 24);
+        planes[size + i] = static_cast<unsigned char>(word >> 16);
+        planes[2 * size + i] = static_cast<unsigned char>(word >> 8);
+        planes[3 * size + i] = static_cast<unsigned char>(word);
+    }
+
+    std::vector<unsigned char> compressedData;
+    if (!FITools::compress(planes.empty() ? NULL : &planes.front(), planes.size(), compressedData, Z_DEFAULT_COMPRESSION, parallel.threads,
+                           parallel.blockSize)) {
+        throw X3DParseException("Error while encoding ShufflezlibFloatArrayAlgorithm");
     }
-    delete[] compressedData;
+
+    octets.push_back(static_cast<unsigned char>(stride));
+    appendUInt(octets, static_cast<unsigned int>(size));
+    octets.insert(octets.end(), compressedData.begin(), compressedData.end());
+}
+
+std::string MeshIndexAlgorithm::decodeToString(const FI::OctetString &octets) const {
+    std::vector<int> intArray;
+    decodeToIntArray(octets, intArray);
+
+    std::stringstream ss;
+    for (size_t i = 0; i < intArray.size(); i++)
+        ss << (i ? " " : "") << intArray[i];
+    return ss.str();
 }
+
+void MeshIndexAlgorithm::decodeToIntArray(const FI::OctetString &octets, std::vector<int> &vec) {
+    if (octets.size() < 8)
+        throw X3DParseException("Invalid MeshIndexAlgorithm data");
+    size_t length = FI::Tools::readUInt(octets.data());
+    size_t numExplicit = FI::Tools::readUInt(octets.data() + 4);
+
+    std::vector<unsigned char> data(length + numExplicit * 4);
+    if (!data.empty()) {
+        uLongf destSize = static_cast<uLongf>(data.size());
+        int result_code = uncompress(&data.front(), &destSize, octets.data() + 8, static_cast<uLong>(octets.size() - 8));
+        if (result_code != Z_OK || destSize != data.size()) {
+            std::stringstream ss;
+            ss << "Error while decoding MeshIndexAlgorithm. ZLIB error code: " << result_code;
+            throw X3DParseException(ss.str());
+        }
+    }
+
+    std::vector<int> result(length);
+    const unsigned char *explicitValues = data.empty() ? NULL : &data.front() + length;
+    size_t explicitCount = 0;
+    long long nextNew = 0;
+    VertexCache cache;
+    for (size_t i = 0; i < length; i++) {
+        unsigned char code = data[i];
+        int value;
+        if (code == MESH_CODE_END) {
+            result[i] = -1;
+            continue;
+        } else if (code == MESH_CODE_NEW) {
+            value = static_cast<int>(nextNew);
+        } else if (code == MESH_CODE_EXPLICIT) {
+            if (explicitCount == numExplicit)
+                throw X3DParseException("Invalid MeshIndexAlgorithm data");
+            unsigned int difference = static_cast<unsigned int>(unzigzag(FI::Tools::readUInt(explicitValues + 4 * explicitCount++)));
+            value = static_cast<int>(static_cast<unsigned int>(nextNew) + difference);
+        } else if (code - MESH_CODE_CACHE < cache.size()) {
+            value = cache.get(code - MESH_CODE_CACHE);
+        } else {
+            throw X3DParseException("Invalid MeshIndexAlgorithm data");
+        }
+        if (value >= nextNew)
+            nextNew = static_cast<long long>(value) + 1;
+        cache.moveToFront(value);
+        result[i] = value;
+    }
+    std::swap(result, vec);
+}
+
+void MeshIndexAlgorithm::encode(const int *values, size_t size, FI::NonEmptyOctetString &octets) {
+    std::vector<unsigned char> data(size);
+    std::vector<unsigned int> explicitValues;
+    long long nextNew = 0;
+    VertexCache cache;
+    for (size_t i = 0; i < size; i++) {
+        int value = values[i];
+        if (value == -1) {
+            data[i] = MESH_CODE_END;
+            continue;
+        }
+        int position = cache.find(value);
+        if (value == nextNew) {
+            data[i] = MESH_CODE_NEW;
+        } else if (position != -1) {
+            data[i] = static_cast<unsigned char>(MESH_CODE_CACHE + position);
+        } else {
+            data[i] = MESH_CODE_EXPLICIT;
+            explicitValues.push_back(zigzag(static_cast<int>(static_cast<unsigned int>(value) - static_cast<unsigned int>(nextNew))));
+        }
+        if (value >= nextNew)
+            nextNew = static_cast<long long>(value) + 1;
+        cache.moveToFront(value);
+    }
+
+    size_t offset = data.size();
+    data.resize(offset + explicitValues.size() * 4);
+    if (!explicitValues.empty())
+        FI::Tools::swapBytes4(reinterpret_cast<const unsigned char *>(&explicitValues.front()), explicitValues.size(), &data[offset]);
+
+    std::vector<unsigned char> compressedData;
+    if (!FITools::compress(data.empty() ? NULL : &data.front(), data.size(), compressedData, Z_DEFAULT_COMPRESSION)) {
+        throw X3DParseException("Error while encoding MeshIndexAlgorithm");
+    }
+
+    appendUInt(octets, static_cast<unsigned int>(size));
+    appendUInt(octets, static_cast<unsigned int>(explicitValues.size()));
+    octets.insert(octets.end(), compressedData.begin(), compressedData.end());
+}
+
+std::string MeshCoordinateAlgorithm::decodeToString(const FI::OctetString &) const {
+    throw X3DParseException("MeshCoordinateAlgorithm: The points can not be decoded without the index of the mesh");
+}
+
+size_t MeshCoordinateAlgorithm::getLength(const FI::OctetString &octets) {
+    if (octets.size() < MESH_COORDINATE_HEADER_SIZE)
+        throw X3DParseException("Invalid MeshCoordinateAlgorithm data");
+    return 3 * static_cast<size_t>(FI::Tools::readUInt(octets.data() + 2));
+}
+
+void MeshCoordinateAlgorithm::decodeToFloatArray(const FI::OctetString &octets, const std::vector<int> &index, std::vector<float> &vec) {
+    size_t size = getLength(octets);
+    const unsigned char *p = octets.data();
+    unsigned int faceSize = p[0];
+    unsigned int bits = p[1];
+    if ((faceSize != 0 && faceSize != 3) || bits < 1 || bits > 30)
+        throw X3DParseException("Invalid MeshCoordinateAlgorithm data");
+    float minimum[3] = {readFloat(p + 6), readFloat(p + 10), readFloat(p + 14)};
+    float range = readFloat(p + 18);
+
+    std::vector<float> result(size);
+    if (size) {
+        std::vector<unsigned char> planes(size * 4);
+        uLongf destSize = static_cast<uLongf>(planes.size());
+        int result_code = uncompress(&planes.front(), &destSize, p + MESH_COORDINATE_HEADER_SIZE,
+                                     static_cast<uLong>(octets.size() - MESH_COORDINATE_HEADER_SIZE));
+        if (result_code != Z_OK || destSize != planes.size()) {
+            std::stringstream ss;
+            ss << "Error while decoding MeshCoordinateAlgorithm. ZLIB error code: " << result_code;
+            throw X3DParseException(ss.str());
+        }
+
+        unsigned int maxValue = (1U << bits) - 1;
+        std::vector<unsigned int> points(size);
+        ResidualReader reader(&planes.front(), size, points);
+        MeshPredictor predictor(index, faceSize, size / 3, maxValue);
+        predictor.run(points, reader);
+
+        double step = static_cast<double>(range) / maxValue;
+        for (size_t i = 0; i < size; i++)
+            result[i] = static_cast<float>(minimum[i % 3] + points[i] * step);
+    }
+    std::swap(result, vec);
+}
+
+void MeshCoordinateAlgorithm::encode(const float *values, size_t size, const std::vector<int> &index, unsigned int faceSize, unsigned int bits,
+                                     FI::NonEmptyOctetString &octets) {
+    if (bits < 1 || bits > 30)
+        throw X3DParseException("MeshCoordinateAlgorithm: Bits out of range, min 1, max 30");
+    if (faceSize != 0 && faceSize != 3)
+        throw X3DParseException("MeshCoordinateAlgorithm: Face size has to be 0 or 3");
+    if (size % 3 != 0)
+        throw X3DParseException("MeshCoordinateAlgorithm: The number of values has to be a multiple of 3");
+    size_t numPoints = size / 3;
+
+    // The bounding box of the finite values
+    float minimum[3] = {0, 0, 0}, maximum[3] = {0, 0, 0};
+    bool empty = true;
+    for (size_t i = 0; i < numPoints; i++) {
+        const float *point = values + 3 * i;
+        if (!(fabs(point[0]) <= FLT_MAX && fabs(point[1]) <= FLT_MAX && fabs(point[2]) <= FLT_MAX))
+            continue;
+        for (int d = 0; d < 3; d++) {
+            minimum[d] = empty ? point[d] : std::min(minimum[d], point[d]);
+            maximum[d] = empty ? point[d] : std::max(maximum[d], point[d]);
+        }
+        empty = false;
+    }
+    float range = std::max(maximum[0] - minimum[0], std::max(maximum[1] - minimum[1], maximum[2] - minimum[2]));
+
+    // Quantize to the grid, the same for all axes so the parallelograms fit
+    unsigned int maxValue = (1U << bits) - 1;
+    double scale = range > 0 ? maxValue / static_cast<double>(range) : 0;
+    std::vector<unsigned int> points(size);
+    for (size_t i = 0; i < size; i++) {
+        double value = floor((values[i] - minimum[i % 3]) * scale + 0.5);
+        // Also maps NaN to 0
+        points[i] = value >= 0 ? static_cast<unsigned int>(std::min(value, static_cast<double>(maxValue))) : 0;
+    }
+
+    std::vector<unsigned int> residuals;
+    residuals.reserve(size);
+    ResidualWriter writer(points, residuals);
+    MeshPredictor predictor(index, faceSize, numPoints, maxValue);
+    predictor.run(points, writer);
+
+    std::vector<unsigned char> planes;
+    appendPlanes(planes, residuals);
+    std::vector<unsigned char> compressedData;
+    if (!FITools::compress(planes.empty() ? NULL : &planes.front(), planes.size(), compressedData, Z_DEFAULT_COMPRESSION)) {
+        throw X3DParseException("Error while encoding MeshCoordinateAlgorithm");
+    }
+
+    octets.push_back(static_cast<unsigned char>(faceSize));
+    octets.push_back(static_cast<unsigned char>(bits));
+    appendUInt(octets, static_cast<unsigned int>(numPoints));
+    for (int d = 0; d < 3; d++)
+        appendFloat(octets, minimum[d]);
+    appendFloat(octets, range);
+    octets.insert(octets.end(), compressedData.begin(), compressedData.end());
+}
+
+std::string VarintzlibIntArrayAlgorithm::decodeToString(const FI::OctetString &octets) const {
+    std::vector<int> intArray;
+    decodeToIntArray(octets, intArray);
+
+    std::stringstream ss;
+    for (size_t i = 0; i < intArray.size(); i++)
+        ss << (i ? " " : "") << intArray[i];
+    return ss.str();
+}
+
+void VarintzlibIntArrayAlgorithm::decodeToIntArray(const FI::OctetString &octets, std::vector<int> &vec) {
+    if (octets.size() < 9)
+        throw X3DParseException("Invalid VarintzlibIntArrayAlgorithm data");
+    size_t length = FI::Tools::readUInt(octets.data());
+    size_t varintLength = FI::Tools::readUInt(octets.data() + 4);
+    size_t span = octets[8];
+    // Each value takes one to five octets, and deflate expands at most 1032:1
+    if (varintLength < length || varintLength > length * 5 || varintLength > (octets.size() - 9) * 1032 + 64)
+        throw X3DParseException("Invalid VarintzlibIntArrayAlgorithm data");
+
+    std::vector<int> result(length);
+    if (!length) {
+        std::swap(result, vec);
+        return;
+    }
+
+    std::vector<unsigned char> varints(varintLength);
+    uLongf destSize = static_cast<uLongf>(varintLength);
+    int result_code = uncompress(&varints.front(), &destSize, octets.data() + 9, static_cast<uLong>(octets.size() - 9));
+    if (result_code != Z_OK || destSize != varintLength) {
+        std::stringstream ss;
+        ss << "Error while decoding VarintzlibIntArrayAlgorithm. ZLIB error code: " << result_code;
+        throw X3DParseException(ss.str());
+    }
+
+    const unsigned char *p = &varints.front();
+    const unsigned char *end = p + varintLength;
+    for (size_t i = 0; i < length; i++) {
+        if (p == end)
+            throw X3DParseException("Invalid VarintzlibIntArrayAlgorithm data");
+        unsigned int value = *p++;
+        if (value & 0x80) {
+            // Longer varints are rare in an index
+            value &= 0x7f;
+            unsigned int octet;
+            int shift = 7;
+            do {
+                if (p == end || shift > 28)
+                    throw X3DParseException("Invalid VarintzlibIntArrayAlgorithm data");
+                octet = *p++;
+                value |= (octet & 0x7f) << shift;
+                shift += 7;
+            } while (octet & 0x80);
+        }
+        unsigned int prediction = span && i >= span ? static_cast<unsigned int>(result[i - span]) : 0;
+        result[i] = static_cast<int>(prediction + static_cast<unsigned int>(unzigzag(value)));
+    }
+    std::swap(result, vec);
+}
+
+void VarintzlibIntArrayAlgorithm::encode(const int *values, size_t size, FI::NonEmptyOctetString &octets, const ParallelCompression &parallel) {
+    // The same span as the DeltazlibIntArrayAlgorithm
+    size_t span = 4;
+    for (size_t i = 0; i < std::min(size, static_cast<size_t>(20)); i++) {
+        if (values[i] == -1) {
+            span = i + 1;
+            break;
+        }
+    }
+
+    std::vector<unsigned char> varints;
+    varints.reserve(size + size / 4);
+    for (size_t i = 0; i < size; i++) {
+        unsigned int prediction = i >= span ? static_cast<unsigned int>(values[i - span]) : 0;
+        unsigned int value = zigzag(static_cast<int>(static_cast<unsigned int>(values[i]) - prediction));
+        while (value >= 0x80) {
+            varints.push_back(static_cast<unsigned char>(value | 0x80));
+            value >>= 7;
+        }
+        varints.push_back(static_cast<unsigned char>(value));
+    }
+
+    std::vector<unsigned char> compressedData;
+    if (!FITools::compress(varints.empty() ? NULL : &varints.front(), varints.size(), compressedData, Z_DEFAULT_COMPRESSION, parallel.threads,
+                           parallel.blockSize)) {
+        throw X3DParseException("Error while encoding VarintzlibIntArrayAlgorithm");
+    }
+
+    appendUInt(octets, static_cast<unsigned int>(size));
+    appendUInt(octets, static_cast<unsigned int>(varints.size()));
+    octets.push_back(static_cast<unsigned char>(span));
+    octets.insert(octets.end(), compressedData.begin(), compressedData.end());
+}
+
 }  // namespace XIOT
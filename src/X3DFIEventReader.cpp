@@ -0,0 +1,110 @@
+#include <xiot/X3DFIEventReader.h>
+
+#include <xiot/FIPullParser.h>
+#include <xiot/X3DParseException.h>
+#include <xiot/X3DParserVocabulary.h>
+
+#include <cassert>
+#include <exception>
+
+namespace XIOT {
+
+X3DFIEventReader::X3DFIEventReader() : _parser(NULL), _attributes(NULL, NULL), _memoryMapping(true) {
+}
+
+X3DFIEventReader::~X3DFIEventReader() {
+    close();
+}
+
+bool X3DFIEventReader::open(const char *fileStr) {
+    close();
+
+    _parser = new FI::PullParser();
+    if (_memoryMapping && _mappedFile.open(fileStr)) {
+        _parser->setInputSource(&_mappedFile);
+    } else {
+        _file.open(fileStr, std::istream::binary | std::istream::in);
+        if (!_file.is_open()) {
+            close();
+            return false;
+        }
+        _parser->setStream(&_file);
+    }
+
+    FI::ParserVocabulary *vocabulary = new XIOT::X3DParserVocabulary();
+    _parser->addExternalVocabularies(vocabulary->getExternalVocabularyURI(), vocabulary);
+    return true;
+}
+
+void X3DFIEventReader::close() {
+    delete _parser;
+    _parser = NULL;
+    _mappedFile.close();
+    if (_file.is_open())
+        _file.close();
+    _file.clear();
+    _eventType = START_DOCUMENT;
+    _elementID = -1;
+    _meshContext.clear();
+}
+
+bool X3DFIEventReader::hasNext() const {
+    return _parser && _parser->hasNext();
+}
+
+X3DEventReader::EventType X3DFIEventReader::next() {
+    if (!hasNext())
+        throw X3DParseException("No more events");
+
+    FI::PullParser::EventType event;
+    try {
+        event = _parser->next();
+        // Skip whitespace between elements like the XML reader
+        while (event == FI::PullParser::CHARACTERS) {
+            _characters = _parser->getVocabulary()->resolveCharacterChunk(_parser->getCharacterChunk().characterCodes);
+            if (_characters.find_first_not_of(" \t\r\n") != std::string::npos)
+                break;
+            event = _parser->next();
+        }
+    } catch (X3DParseException &) {
+        throw;
+    } catch (std::exception &e) {
+        throw X3DParseException(e.what());
+    }
+
+    switch (event) {
+        case FI::PullParser::START_DOCUMENT:
+            _eventType = START_DOCUMENT;
+            break;
+        case FI::PullParser::END_DOCUMENT:
+            _eventType = END_DOCUMENT;
+            break;
+        case FI::PullParser::START_ELEMENT:
+            _eventType = START_ELEMENT;
+            _elementID = _parser->getElement()._qualifiedName._nameSurrogateIndex - 1;
+            _meshContext.startElement(_elementID, _parser->getAttributes());
+            _attributes = X3DFIAttributes(&_parser->getAttributes(), _parser->getVocabulary(), &_meshContext);
+            break;
+        case FI::PullParser::END_ELEMENT:
+            _eventType = END_ELEMENT;
+            _elementID = _parser->getElement()._qualifiedName._nameSurrogateIndex - 1;
+            _meshContext.endElement();
+            break;
+        case FI::PullParser::CHARACTERS:
+            _eventType = CHARACTERS;
+            break;
+    }
+    return _eventType;
+}
+
+const X3DAttributes &X3DFIEventReader::getAttributes() const {
+    assert(_eventType == START_ELEMENT);
+    return _attributes;
+}
+
+std::string X3DFIEventReader::getCharacters() const {
+    assert(_eventType == CHARACTERS);
+    return _characters;
+}
+
+}  // namespace XIOT
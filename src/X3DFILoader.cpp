@@ -2,9 +2,13 @@
 
 #include <xiot/FIConstants.h>
 #include <xiot/FIContentHandler.h>
+#include <xiot/FIInputSource.h>
+#include <xiot/FIPushParser.h>
 #include <xiot/FISAXParser.h>
 #include <xiot/FITypes.h>
 #include <xiot/X3DFIAttributes.h>
+#include <xiot/X3DFIEncodingAlgorithms.h>
+#include <xiot/X3DInterestMask.h>
 #include <xiot/X3DParserVocabulary.h>
 
 #include <cassert>
@@ -14,9 +18,12 @@
 
 namespace XIOT {
 
+/// Thrown by the content handler to stop decoding if a node callback returns ABORT
+struct X3DFIAbort {};
+
 class X3DFIContentHandler : public FI::DefaultContentHandler {
   public:
-    X3DFIContentHandler(X3DNodeHandler *nodeHandler);
+    X3DFIContentHandler(X3DNodeHandler *nodeHandler, const X3DInterestMask *mask, FI::SAXParser *parser = NULL);
     virtual ~X3DFIContentHandler(){};
 
     virtual void startDocument();
@@ -25,13 +32,21 @@ class X3DFIContentHandler : public FI::DefaultContentHandler {
     virtual void startElement(const FI::ParserVocabulary *vocab, const FI::Element &element, const FI::Attributes &attributes);
     virtual void endElement(const FI::ParserVocabulary *vocab, const FI::Element &element);
 
+    virtual bool isAttributeOfInterest(const FI::ParserVocabulary *vocab, const FI::Element &element, const FI::QualifiedNameOrIndex &name);
+    virtual bool isEncodedAttributeOfInterest(const FI::ParserVocabulary *vocab, const FI::Element &element, const FI::QualifiedNameOrIndex &name, int encodingAlgorithm);
+
   private:
     X3DNodeHandler *_nodeHandler;
+    /// Nodes of interest, NULL for all
+    const X3DInterestMask *_mask;
+    /// Parser to skip children in, NULL for the PushParser
+    FI::SAXParser *_parser;
     X3DSwitch _switch;
     int _skipCount;
+    X3DFIMeshContext _meshContext;
 };
 
-X3DFIContentHandler::X3DFIContentHandler(X3DNodeHandler *nodeHandler) : _nodeHandler(nodeHandler), _skipCount(0) {
+X3DFIContentHandler::X3DFIContentHandler(X3DNodeHandler *nodeHandler, const X3DInterestMask *mask, FI::SAXParser *parser) : _nodeHandler(nodeHandler), _mask(mask), _parser(parser), _skipCount(0) {
     _switch.setNodeHandler(nodeHandler);
 }
 
@@ -44,44 +59,77 @@ void X3DFIContentHandler::endDocument() {
 }
 
 void X3DFIContentHandler::startElement(const FI::ParserVocabulary *vocab, const FI::Element &element, const FI::Attributes &attributes) {
+    _meshContext.startElement(element._qualifiedName._nameSurrogateIndex - 1, attributes);
     if (_skipCount != 0) {
         _skipCount++;
         return;
     }
-    X3DFIAttributes fiAttributes(&attributes, vocab);
     int id = element._qualifiedName._nameSurrogateIndex - 1;
+    if (_mask && !_mask->hasNode(id))
+        return;
+    X3DFIAttributes fiAttributes(&attributes, vocab, &_meshContext);
     int state = _switch.doStartElement(id, fiAttributes);
-    if (state == XIOT::SKIP_CHILDREN)
+    if (state == XIOT::SKIP_CHILDREN) {
         _skipCount = 1;
+        if (_parser)
+            _parser->skipChildren();
+    } else if (state == XIOT::ABORT)
+        throw X3DFIAbort();
 }
 
 void X3DFIContentHandler::endElement(const FI::ParserVocabulary *, const FI::Element &element) {
+    _meshContext.endElement();
     if (_skipCount != 0) {
         _skipCount--;
         return;
     }
     int id = element._qualifiedName._nameSurrogateIndex - 1;
-    _switch.doEndElement(id, "");
+    if (_mask && !_mask->hasNode(id))
+        return;
+    if (_switch.doEndElement(id, "") == XIOT::ABORT)
+        throw X3DFIAbort();
+}
+
+bool X3DFIContentHandler::isAttributeOfInterest(const FI::ParserVocabulary *, const FI::Element &element, const FI::QualifiedNameOrIndex &name) {
+    int elementID = element._qualifiedName._nameSurrogateIndex - 1;
+    int attributeID = name._nameSurrogateIndex - 1;
+    return !_mask || _mask->hasAttribute(elementID, attributeID);
+}
+
+bool X3DFIContentHandler::isEncodedAttributeOfInterest(const FI::ParserVocabulary *, const FI::Element &element, const FI::QualifiedNameOrIndex &name, int encodingAlgorithm) {
+    // The mesh context needs an index encoded for the points of the children
+    int elementID = element._qualifiedName._nameSurrogateIndex - 1;
+    int attributeID = name._nameSurrogateIndex - 1;
+    return encodingAlgorithm == MeshIndexAlgorithm::ALGORITHM_ID &&
+           ((elementID == ID::IndexedFaceSet && attributeID == ID::coordIndex) || (elementID == ID::IndexedTriangleSet && attributeID == ID::index));
 }
 
 
-X3DFILoader::X3DFILoader() {
+X3DFILoader::X3DFILoader() : _memoryMapping(true), _pushParser(NULL), _pushHandler(NULL), _chunkAborted(false) {
 }
 
 X3DFILoader::~X3DFILoader() {
+    endChunkedLoad();
     file.close();
 }
 
 bool X3DFILoader::load(const char *fileStr, bool) {
     assert(_handler);
+    _aborted = false;
     x3dswitch.setNodeHandler(_handler);
 
-    FI::ContentHandler *handler = new X3DFIContentHandler(_handler);
     FI::SAXParser parser;
+    FI::ContentHandler *handler = new X3DFIContentHandler(_handler, _interestMask, &parser);
 
-    std::ifstream fs(fileStr, std::istream::binary | std::istream::in);
+    FI::MemoryMappedInputSource mappedFile;
+    std::ifstream fs;
 
-    parser.setStream(&fs);
+    if (_memoryMapping && mappedFile.open(fileStr)) {
+        parser.setInputSource(&mappedFile);
+    } else {
+        fs.open(fileStr, std::istream::binary | std::istream::in);
+        parser.setStream(&fs);
+    }
     parser.setContentHandler(handler);
 
     FI::ParserVocabulary *vocabulary = new XIOT::X3DParserVocabulary();
@@ -89,6 +137,11 @@ bool X3DFILoader::load(const char *fileStr, bool) {
 
     try {
         parser.parse();
+    } catch (X3DFIAbort &) {
+        mappedFile.close();
+        fs.close();
+        _aborted = true;
+        _handler->endDocument();
     } catch (std::exception &e) {
         std::cerr << std::endl
                   << "Parsing failed: " << e.what() << std::endl;
@@ -99,5 +152,48 @@ bool X3DFILoader::load(const char *fileStr, bool) {
     return true;
 }
 
+bool X3DFILoader::loadChunk(const char *data, size_t length, bool isFinal) {
+    assert(_handler);
+    // The rest of an aborted document is ignored
+    if (_chunkAborted) {
+        _chunkAborted = !isFinal;
+        return true;
+    }
+    if (!_pushParser) {
+        _aborted = false;
+        _pushHandler = new X3DFIContentHandler(_handler, _interestMask);
+        _pushParser = new FI::PushParser();
+        _pushParser->setContentHandler(_pushHandler);
+
+        FI::ParserVocabulary *vocabulary = new XIOT::X3DParserVocabulary();
+        _pushParser->addExternalVocabularies(vocabulary->getExternalVocabularyURI(), vocabulary);
+    }
+
+    try {
+        _pushParser->parse(data, length, isFinal);
+    } catch (X3DFIAbort &) {
+        endChunkedLoad();
+        _aborted = true;
+        _chunkAborted = !isFinal;
+        _handler->endDocument();
+        return true;
+    } catch (std::exception &e) {
+        std::cerr << std::endl
+                  << "Parsing failed: " << e.what() << std::endl;
+        endChunkedLoad();
+        return false;
+    }
+    if (isFinal)
+        endChunkedLoad();
+    return true;
+}
+
+void X3DFILoader::endChunkedLoad() {
+    delete _pushParser;
+    delete _pushHandler;
+    _pushParser = NULL;
+    _pushHandler = NULL;
+}
+
 
 }  // namespace XIOT
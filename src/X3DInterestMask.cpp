@@ -0,0 +1,43 @@
+#include <xiot/X3DInterestMask.h>
+
+namespace XIOT {
+
+X3DInterestMask::X3DInterestMask() : _nodes(ID::X3DELEMENT_COUNT + 1, false) {
+}
+
+X3DInterestMask::~X3DInterestMask() {
+}
+
+void X3DInterestMask::addNode(int nodeID) {
+    if (nodeID >= 0 && nodeID < ID::X3DELEMENT_COUNT)
+        _nodes[nodeID + 1] = true;
+    else
+        _nodes[0] = true;
+}
+
+void X3DInterestMask::addAllNodes() {
+    _nodes.assign(_nodes.size(), true);
+}
+
+void X3DInterestMask::addAttribute(int nodeID, int attributeID) {
+    addNode(nodeID);
+    if (attributeID < 0 || attributeID >= ID::X3DATTRIBUTE_COUNT)
+        return;
+
+    std::vector<bool> &attributes = _attributes[nodeID];
+    if (attributes.empty())
+        attributes.resize(ID::X3DATTRIBUTE_COUNT, false);
+    attributes[attributeID] = true;
+}
+
+bool X3DInterestMask::hasAttribute(int nodeID, int attributeID) const {
+    if (!hasNode(nodeID))
+        return false;
+
+    std::map<int, std::vector<bool> >::const_iterator I = _attributes.find(nodeID);
+    if (I == _attributes.end())
+        return true;
+    return attributeID >= 0 && attributeID < ID::X3DATTRIBUTE_COUNT && I->second[attributeID];
+}
+
+}  // namespace XIOT
@@ -12,7 +12,7 @@ using namespace std;
 namespace XIOT {
 
 X3DLoader::X3DLoader()
-    : _handler(NULL) {
+    : _handler(NULL), _interestMask(NULL), _aborted(false) {
 }
 
 X3DLoader::~X3DLoader() {
@@ -20,17 +20,23 @@ X3DLoader::~X3DLoader() {
 
 bool X3DLoader::load(const char *fileStr, bool fileValidation) const {
     assert(_handler);
-    X3DTypes::initMaps();
+    _aborted = false;
     std::string fileName(fileStr);
     std::string extensionStr = fileName.substr(fileName.find_last_of('.') + 1, fileName.size());
     if (extensionStr == "x3d") {
         X3DXMLLoader xmlLoader;
         xmlLoader.setNodeHandler(_handler);
-        return xmlLoader.load(fileStr, fileValidation);
+        xmlLoader.setInterestMask(_interestMask);
+        bool result = xmlLoader.load(fileStr, fileValidation);
+        _aborted = xmlLoader.wasAborted();
+        return result;
     } else if (extensionStr == "x3db") {
         X3DFILoader fiLoader;
         fiLoader.setNodeHandler(_handler);
-        return fiLoader.load(fileStr, fileValidation);
+        fiLoader.setInterestMask(_interestMask);
+        bool result = fiLoader.load(fileStr, fileValidation);
+        _aborted = fiLoader.wasAborted();
+        return result;
     }
     return false;
 }
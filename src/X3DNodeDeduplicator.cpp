@@ -0,0 +1,371 @@
+#include <xiot/X3DNodeDeduplicator.h>
+
+#include <sstream>
+
+#include <xiot/X3DTypes.h>
+#include <xiot/X3DWriter.h>
+
+namespace XIOT {
+
+namespace {
+
+const int START_NODE = -1;
+const int END_NODE = -2;
+
+// 64 bit FNV-1a
+const unsigned long long FNV_OFFSET = 14695981039346656037ULL;
+const unsigned long long FNV_PRIME = 1099511628211ULL;
+// A multiply and xorshift hash, independent of FNV-1a, to check a match
+const unsigned long long CHECK_OFFSET = 0x243F6A8885A308D3ULL;
+const unsigned long long CHECK_MULTIPLIER = 0x9E3779B97F4A7C15ULL;
+
+/// The two hashes of some content
+struct Hashes {
+    Hashes() : hash(FNV_OFFSET), check(CHECK_OFFSET){};
+
+    void add(const void *data, size_t size) {
+        const unsigned char *bytes = static_cast<const unsigned char *>(data);
+        for (size_t i = 0; i < size; i++) {
+            hash ^= bytes[i];
+            hash *= FNV_PRIME;
+            check += bytes[i] + 1;
+            check *= CHECK_MULTIPLIER;
+            check ^= check >> 29;
+        }
+    };
+
+    unsigned long long hash;
+    unsigned long long check;
+};
+
+/// The geometry nodes and the nodes holding their arrays
+bool isDeduplicated(int nodeID) {
+    switch (nodeID) {
+    case ID::IndexedFaceSet:
+    case ID::IndexedLineSet:
+    case ID::IndexedTriangleSet:
+    case ID::IndexedTriangleFanSet:
+    case ID::IndexedTriangleStripSet:
+    case ID::IndexedQuadSet:
+    case ID::LineSet:
+    case ID::PointSet:
+    case ID::TriangleSet:
+    case ID::TriangleFanSet:
+    case ID::TriangleStripSet:
+    case ID::QuadSet:
+    case ID::ElevationGrid:
+    case ID::Coordinate:
+    case ID::Normal:
+    case ID::Color:
+    case ID::ColorRGBA:
+    case ID::TextureCoordinate:
+        return true;
+    default:
+        return false;
+    }
+}
+
+}  // namespace
+
+/*======================================================================== */
+struct RecordedCall {
+    RecordedCall(int _type, int _id) : type(_type), id(_id), end(0), size(0), octets(0), arrays(0), isUse(false), isNamed(false) {
+    }
+    /// A X3DNodeDeduplicator::FieldType, START_NODE or END_NODE
+    int type;
+    /// The node or attribute ID
+    int id;
+    std::vector<float> floats;
+    std::vector<int> ints;
+    std::vector<bool> bools;
+    std::vector<std::string> strings;
+
+    // The content of a START_NODE call, including the children
+    Hashes hashes;
+    /// The index of the END_NODE call
+    size_t end;
+    /// The octets of all hashed fields
+    size_t size;
+    size_t octets;
+    size_t arrays;
+    bool isUse;
+    /// true, if the node or one of its children has a DEF
+    bool isNamed;
+};
+
+//----------------------------------------------------------------------------
+X3DNodeDeduplicator::X3DNodeDeduplicator(X3DWriter &writer) : _writer(writer), _minimumSize(0), _isWriting(false), _nextName(0) {
+    _calls = new std::deque<RecordedCall>;
+}
+
+//----------------------------------------------------------------------------
+X3DNodeDeduplicator::~X3DNodeDeduplicator() {
+    delete _calls;
+}
+
+//----------------------------------------------------------------------------
+void X3DNodeDeduplicator::setMinimumSize(size_t octets) {
+    _minimumSize = octets;
+}
+
+//----------------------------------------------------------------------------
+void X3DNodeDeduplicator::reset() {
+    _calls->clear();
+    _openNodes.clear();
+    _names.clear();
+    _definedNames.clear();
+    _statistics = DeduplicationStatistics();
+    _isWriting = false;
+    _nextName = 0;
+}
+
+//----------------------------------------------------------------------------
+bool X3DNodeDeduplicator::startNode(int nodeID) {
+    if (_isWriting || !_minimumSize || (_calls->empty() && !isDeduplicated(nodeID)))
+        return false;
+
+    _calls->push_back(RecordedCall(START_NODE, nodeID));
+    this->record();
+    _calls->back().hashes.add(&nodeID, sizeof(nodeID));
+    _openNodes.push_back(_calls->size() - 1);
+    return true;
+}
+
+//----------------------------------------------------------------------------
+bool X3DNodeDeduplicator::endNode() {
+    if (_isWriting || _calls->empty())
+        return false;
+
+    size_t node = _openNodes.back();
+    _openNodes.pop_back();
+    _calls->push_back(RecordedCall(END_NODE, 0));
+    this->record();
+    (*_calls)[node].end = _calls->size() - 1;
+    if (!_openNodes.empty())
+        return true;
+
+    // The outermost node is complete
+    _isWriting = true;
+    this->write(0, _calls->size());
+    _calls->clear();
+    _isWriting = false;
+    return true;
+}
+
+//----------------------------------------------------------------------------
+bool X3DNodeDeduplicator::setFloats(FieldType type, int attributeID, const float *values, size_t size) {
+    if (_isWriting || _calls->empty())
+        return false;
+
+    _calls->push_back(RecordedCall(type, attributeID));
+    _calls->back().floats.assign(values, values + size);
+    this->record();
+    return true;
+}
+
+//----------------------------------------------------------------------------
+bool X3DNodeDeduplicator::setInts(FieldType type, int attributeID, const int *values, size_t size) {
+    if (_isWriting || _calls->empty())
+        return false;
+
+    _calls->push_back(RecordedCall(type, attributeID));
+    _calls->back().ints.assign(values, values + size);
+    this->record();
+    return true;
+}
+
+//----------------------------------------------------------------------------
+bool X3DNodeDeduplicator::setBools(int attributeID, const std::vector<bool> &values) {
+    if (_isWriting || _calls->empty())
+        return false;
+
+    _calls->push_back(RecordedCall(MFBool, attributeID));
+    _calls->back().bools = values;
+    this->record();
+    return true;
+}
+
+//----------------------------------------------------------------------------
+bool X3DNodeDeduplicator::setStrings(FieldType type, int attributeID, const std::string *values, size_t size) {
+    if (_minimumSize && attributeID == ID::DEF && size == 1)
+        _definedNames.insert(values[0]);
+    if (_isWriting || _calls->empty())
+        return false;
+
+    _calls->push_back(RecordedCall(type, attributeID));
+    _calls->back().strings.assign(values, values + size);
+    this->record();
+    return true;
+}
+
+//----------------------------------------------------------------------------
+void X3DNodeDeduplicator::record() {
+    const RecordedCall &call = _calls->back();
+    if (call.type == SFString && call.id == ID::DEF) {
+        // The node may be the target of a ROUTE, it and its parents are kept
+        for (size_t i = 0; i < _openNodes.size(); i++)
+            (*_calls)[_openNodes[i]].isNamed = true;
+    }
+    if (call.type == SFString && call.id == ID::USE)
+        (*_calls)[_openNodes.back()].isUse = true;
+
+    Hashes hashes;
+    hashes.add(&call.type, sizeof(call.type));
+    hashes.add(&call.id, sizeof(call.id));
+    size_t octets = 0;
+    if (!call.floats.empty()) {
+        octets = call.floats.size() * sizeof(float);
+        hashes.add(&call.floats.front(), octets);
+    } else if (!call.ints.empty()) {
+        octets = call.ints.size() * sizeof(int);
+        hashes.add(&call.ints.front(), octets);
+    }
+    size_t size = octets;
+    for (size_t i = 0; i < call.bools.size(); i++) {
+        unsigned char value = call.bools[i];
+        hashes.add(&value, 1);
+    }
+    size += call.bools.size();
+    for (size_t i = 0; i < call.strings.size(); i++) {
+        size_t length = call.strings[i].size();
+        hashes.add(&length, sizeof(length));
+        hashes.add(call.strings[i].data(), length);
+        size += length;
+    }
+
+    // Only the arrays count for the minimum size
+    bool isArray = call.type >= SFImage && call.type != MFString;
+    if (isArray && call.type == MFBool)
+        octets = (call.bools.size() + 7) / 8;
+    if (!isArray)
+        octets = 0;
+    bool isEncodedArray = isArray && call.type != MFBool;
+
+    for (size_t i = 0; i < _openNodes.size(); i++) {
+        RecordedCall &node = (*_calls)[_openNodes[i]];
+        node.hashes.add(&hashes.hash, sizeof(hashes.hash));
+        node.hashes.add(&hashes.check, sizeof(hashes.check));
+        node.size += size;
+        node.octets += octets;
+        node.arrays += isEncodedArray ? 1 : 0;
+    }
+}
+
+//----------------------------------------------------------------------------
+void X3DNodeDeduplicator::write(size_t begin, size_t end) {
+    for (size_t i = begin; i < end; i++) {
+        const RecordedCall &call = (*_calls)[i];
+        if (call.type != START_NODE) {
+            this->writeCall(call);
+            continue;
+        }
+
+        if (call.isUse || call.isNamed || !isDeduplicated(call.id) || call.octets < _minimumSize) {
+            _writer.startNode(call.id);
+            continue;
+        }
+
+        Content content;
+        content.hash = call.hashes.hash;
+        content.check = call.hashes.check;
+        content.size = call.size;
+        std::map<Content, std::string>::const_iterator I = _names.find(content);
+        if (I == _names.end()) {
+            std::string &name = _names[content];
+            name = this->createName();
+            _writer.startNode(call.id);
+            _writer.setSFString(ID::DEF, name);
+            continue;
+        }
+
+        _writer.startNode(call.id);
+        _writer.setSFString(ID::USE, I->second);
+        _writer.endNode();
+        _statistics.nodes++;
+        _statistics.arrays += call.arrays;
+        _statistics.octets += call.octets;
+        i = call.end;
+    }
+}
+
+//----------------------------------------------------------------------------
+std::string X3DNodeDeduplicator::createName() {
+    while (true) {
+        std::ostringstream name;
+        name << "_xiot" << _nextName++;
+        if (_definedNames.find(name.str()) == _definedNames.end())
+            return name.str();
+    }
+}
+
+//----------------------------------------------------------------------------
+bool X3DNodeDeduplicator::Content::operator<(const Content &other) const {
+    if (hash != other.hash)
+        return hash < other.hash;
+    if (check != other.check)
+        return check < other.check;
+    return size < other.size;
+}
+
+//----------------------------------------------------------------------------
+void X3DNodeDeduplicator::writeCall(const RecordedCall &call) {
+    const std::vector<float> &f = call.floats;
+    switch (call.type) {
+    case END_NODE:
+        _writer.endNode();
+        break;
+    case SFFloat:
+        _writer.setSFFloat(call.id, f[0]);
+        break;
+    case SFInt32:
+        _writer.setSFInt32(call.id, call.ints[0]);
+        break;
+    case SFBool:
+        _writer.setSFBool(call.id, call.ints[0] != 0);
+        break;
+    case SFVec3f:
+        _writer.setSFVec3f(call.id, f[0], f[1], f[2]);
+        break;
+    case SFVec2f:
+        _writer.setSFVec2f(call.id, f[0], f[1]);
+        break;
+    case SFRotation:
+        _writer.setSFRotation(call.id, f[0], f[1], f[2], f[3]);
+        break;
+    case SFString:
+        _writer.setSFString(call.id, call.strings[0]);
+        break;
+    case SFColor:
+        _writer.setSFColor(call.id, f[0], f[1], f[2]);
+        break;
+    case SFImage:
+        _writer.setSFImage(call.id, call.ints);
+        break;
+    case MFBool:
+        _writer.setMFBool(call.id, call.bools);
+        break;
+    case MFFloat:
+        _writer.setMFFloat(call.id, f);
+        break;
+    case MFInt32:
+        _writer.setMFInt32(call.id, call.ints);
+        break;
+    case MFVec3f:
+        _writer.setMFVec3f(call.id, f);
+        break;
+    case MFVec2f:
+        _writer.setMFVec2f(call.id, f);
+        break;
+    case MFRotation:
+        _writer.setMFRotation(call.id, f);
+        break;
+    case MFString:
+        _writer.setMFString(call.id, call.strings);
+        break;
+    case MFColor:
+        _writer.setMFColor(call.id, f);
+        break;
+    }
+}
+
+}  // namespace XIOT
@@ -0,0 +1,35 @@
+#include <xiot/X3DOutputSink.h>
+
+namespace XIOT {
+
+//----------------------------------------------------------------------------
+void X3DMemorySink::write(const char *data, size_t size) {
+    _buffer.insert(_buffer.end(), data, data + size);
+}
+
+//----------------------------------------------------------------------------
+void X3DMemorySink::reserve(size_t size) {
+    _buffer.reserve(size);
+}
+
+//----------------------------------------------------------------------------
+void X3DMemorySink::clear() {
+    _buffer.clear();
+}
+
+//----------------------------------------------------------------------------
+void X3DMemorySink::swap(std::vector<char> &buffer) {
+    _buffer.swap(buffer);
+}
+
+//----------------------------------------------------------------------------
+void X3DStreamSink::write(const char *data, size_t size) {
+    _stream.write(data, static_cast<std::streamsize>(size));
+}
+
+//----------------------------------------------------------------------------
+void X3DStreamSink::flush() {
+    _stream.flush();
+}
+
+}  // namespace XIOT
@@ -1,33 +1,50 @@
 #include <xiot/X3DParserVocabulary.h>
+
+#include <xiot/FIConstants.h>
+#include <xiot/X3DFICodecRegistry.h>
 #include <xiot/X3DTypes.h>
 
 namespace XIOT {
 
-X3DParserVocabulary::X3DParserVocabulary() : DefaultParserVocabulary() {
+namespace {
+
+/// The algorithm of a built-in codec, it is always registered
+template <class Algorithm>
+Algorithm &getRegisteredAlgorithm() {
+    return *static_cast<Algorithm *>(X3DFICodecRegistry::getInstance().findByID(Algorithm::ALGORITHM_ID)->algorithm);
+}
+
+}  // namespace
+
+X3DParserVocabulary::X3DParserVocabulary()
+    : DefaultParserVocabulary(),
+      _quantizedzlibFloatArrayAlgorithm(getRegisteredAlgorithm<QuantizedzlibFloatArrayAlgorithm>()),
+      _deltazlibIntArrayAlgorithm(getRegisteredAlgorithm<DeltazlibIntArrayAlgorithm>()) {
     _externalVocabularyURI = "urn:external-vocabulary";
-    X3DTypes::initMaps();
 
     // Init X3D Element name table
-    std::map<int, std::string>::iterator I = X3DTypes::elementFromIDMap.begin();
-    while (I != X3DTypes::elementFromIDMap.end()) {
-        _elementNames.push_back(FI::QualifiedName((*I).second));
-        I++;
-    }
+    for (int i = 0; i < ID::X3DELEMENT_COUNT; i++)
+        _elementNames.push_back(FI::QualifiedName(X3DTypes::getElementByID(i)));
 
     // Init X3D Attribute name table
-    std::map<int, std::string>::iterator A = X3DTypes::attributeFromIDMap.begin();
-    while (A != X3DTypes::attributeFromIDMap.end()) {
-        _attributeNames.push_back(FI::QualifiedName((*A).second));
-        A++;
-    }
+    for (int i = 0; i < ID::X3DATTRIBUTE_COUNT; i++)
+        _attributeNames.push_back(FI::QualifiedName(X3DTypes::getAttributeByID(i)));
 
     // Init Attribute value table
     _attributeValues.push_back("false");  // Index 1
     _attributeValues.push_back("true");   // Index 2
 
-    addEncodingAlgorithm(NULL);
-    addEncodingAlgorithm(&_deltazlibIntArrayAlgorithm);
-    addEncodingAlgorithm(&_quantizedzlibFloatArrayAlgorithm);
+    // The table starts after ENCODING_ALGORITHM_APPLICATION_START, unused IDs stay empty
+    unsigned int algorithmID = FI::Constants::ENCODING_ALGORITHM_APPLICATION_START + 1;
+    const std::list<X3DFICodec> &codecs = X3DFICodecRegistry::getInstance().getCodecs();
+    for (std::list<X3DFICodec>::const_iterator I = codecs.begin(); I != codecs.end(); I++) {
+        if ((*I).algorithmID < static_cast<int>(algorithmID))
+            continue;
+        for (; static_cast<int>(algorithmID) < (*I).algorithmID; algorithmID++)
+            addEncodingAlgorithm(NULL);
+        addEncodingAlgorithm((*I).algorithm);
+        algorithmID++;
+    }
 };
 
 
@@ -3,58 +3,131 @@
 #include <cstring>
 
 #include <xiot/FIEncodingAlgorithms.h>
+#include <xiot/X3DFICodecRegistry.h>
 #include <xiot/X3DFIEncodingAlgorithms.h>
+#include <xiot/X3DNodeDeduplicator.h>
+#include <xiot/X3DOutputSink.h>
 #include <xiot/X3DTypes.h>
 
 using namespace std;
 
 namespace XIOT {
 
+namespace {
+
+/// Longer text of single value fields is not added to the attribute value table.
+/// Without a table, single value fields are not marked for it at all.
+const size_t MAX_TABLE_VALUE_LENGTH = 32;
+
+/// Passes the blocks of the encoder to the sink, without a buffer of its own
+class SinkStreamBuffer : public std::streambuf {
+  public:
+    SinkStreamBuffer(X3DOutputSink &sink) : _sink(sink) {}
+
+  protected:
+    virtual std::streamsize xsputn(const char *data, std::streamsize size) {
+        _sink.write(data, static_cast<size_t>(size));
+        return size;
+    }
+    virtual int_type overflow(int_type c) {
+        if (!traits_type::eq_int_type(c, traits_type::eof())) {
+            char value = traits_type::to_char_type(c);
+            _sink.write(&value, 1);
+        }
+        return traits_type::not_eof(c);
+    }
+    virtual int sync() {
+        _sink.flush();
+        return 0;
+    }
+
+  private:
+    X3DOutputSink &_sink;
+};
+
+}  // namespace
+
 /*======================================================================== */
 struct NodeInfo {
     NodeInfo(int _nodeId) {
         this->nodeId = _nodeId;
         this->isChecked = false;
         this->attributesTerminated = true;
+        this->faceSize = 0;
     }
     int nodeId;
     bool attributesTerminated;
     bool isChecked;
+    /// Index encoded with the MeshIndexAlgorithm, for the points of the Coordinate child
+    std::vector<int> meshIndex;
+    unsigned int faceSize;
 };
 
 //----------------------------------------------------------------------------
 X3DWriterFI::~X3DWriterFI() {
+    // The encoder buffers the output
+    this->closeFile();
     delete this->_infoStack;
+    delete this->_deduplicator;
 }
 
 //----------------------------------------------------------------------------
 X3DWriterFI::X3DWriterFI() {
     this->_infoStack = new std::vector<NodeInfo>;
+    this->_deduplicator = new X3DNodeDeduplicator(*this);
     this->_isLineFeedEncodingOn = true;
     this->_fastest = 0;
+    this->_binarySingleFields = false;
+    this->_attributeValueTableLimit = _encoder.getAttributeValueTableLimit();
+    this->_arrayDeduplication = 0;
+    this->_output = NULL;
+    this->_sinkBuffer = NULL;
+    this->_sinkStream = NULL;
     this->type = X3DFI;
-    this->_encoder.setStream(_stream);
-    X3DTypes::initMaps();
+    this->_encoder.setStream(_stream, true);
 }
 
 //----------------------------------------------------------------------------
 bool X3DWriterFI::setProperty(const char *const name, void *value) {
     if (name == Property::FloatEncodingAlgorithm) {
-        if (value == Encoder::BuiltIn)
-            _encoder.setFloatAlgorithm(FI::FloatEncodingAlgorithm::ALGORITHM_ID);
-        else if (value == Encoder::QuantizedzlibFloatArrayEncoder)
-            _encoder.setFloatAlgorithm(QuantizedzlibFloatArrayAlgorithm::ALGORITHM_ID);
-        else
+        const X3DFICodec *codec = X3DFICodecRegistry::getInstance().findFloatArrayEncoder(static_cast<const char *>(value));
+        if (!codec)
             return false;
 
+        _encoder.setFloatAlgorithm(codec->algorithmID);
         return true;
     } else if (name == Property::IntEncodingAlgorithm) {
-        if (value == Encoder::BuiltIn)
-            _encoder.setIntAlgorithm(FI::IntEncodingAlgorithm::ALGORITHM_ID);
-        else if (value == Encoder::DeltazlibIntArrayEncoder)
-            _encoder.setIntAlgorithm(DeltazlibIntArrayAlgorithm::ALGORITHM_ID);
-        else
+        const X3DFICodec *codec = X3DFICodecRegistry::getInstance().findIntArrayEncoder(static_cast<const char *>(value));
+        if (!codec)
             return false;
+
+        _encoder.setIntAlgorithm(codec->algorithmID);
+        return true;
+    } else if (name == Property::FloatQuantization) {
+        // NULL restores the lossless default
+        _encoder.setFloatQuantization(value ? *static_cast<FloatQuantization *>(value) : FloatQuantization());
+        return true;
+    } else if (name == Property::ParallelCompression) {
+        // NULL compresses on the calling thread again
+        _encoder.setParallelCompression(value ? *static_cast<ParallelCompression *>(value) : ParallelCompression());
+        return true;
+    } else if (name == Property::MeshCompression) {
+        // NULL switches the mesh encoding off
+        _encoder.setMeshCompression(value ? *static_cast<MeshCompression *>(value) : MeshCompression());
+        return true;
+    } else if (name == Property::BinarySingleFields) {
+        // NULL writes text again
+        _binarySingleFields = value ? *static_cast<bool *>(value) : false;
+        return true;
+    } else if (name == Property::AttributeValueTableLimit) {
+        // NULL writes all values as literals again
+        _attributeValueTableLimit = value ? *static_cast<size_t *>(value) : 0;
+        _encoder.setAttributeValueTableLimit(_attributeValueTableLimit);
+        return true;
+    } else if (name == Property::ArrayDeduplication) {
+        // NULL switches the deduplication off
+        _arrayDeduplication = value ? *static_cast<size_t *>(value) : 0;
+        _deduplicator->setMinimumSize(_arrayDeduplication);
         return true;
     }
     return false;
@@ -64,23 +137,27 @@ bool X3DWriterFI::setProperty(const char *const name, void *value) {
 //----------------------------------------------------------------------------
 void *X3DWriterFI::getProperty(const char *const name) const {
     if (name == Property::FloatEncodingAlgorithm) {
-        int algorithmID = _encoder.getFloatAlgorithm();
-
-        if (algorithmID == FI::FloatEncodingAlgorithm::ALGORITHM_ID)
-            return (void *)Encoder::BuiltIn;
-        if (algorithmID == QuantizedzlibFloatArrayAlgorithm::ALGORITHM_ID)
-            return (void *)Encoder::QuantizedzlibFloatArrayEncoder;
-
-        return NULL;
+        const X3DFICodec *codec = X3DFICodecRegistry::getInstance().findByID(_encoder.getFloatAlgorithm());
+        return codec ? (void *)codec->uri : NULL;
     } else if (name == Property::IntEncodingAlgorithm) {
-        int algorithmID = _encoder.getIntAlgorithm();
-
-        if (algorithmID == FI::IntEncodingAlgorithm::ALGORITHM_ID)
-            return (void *)Encoder::BuiltIn;
-        if (algorithmID == DeltazlibIntArrayAlgorithm::ALGORITHM_ID)
-            return (void *)Encoder::DeltazlibIntArrayEncoder;
-
-        return NULL;
+        const X3DFICodec *codec = X3DFICodecRegistry::getInstance().findByID(_encoder.getIntAlgorithm());
+        return codec ? (void *)codec->uri : NULL;
+    } else if (name == Property::FloatQuantization) {
+        return (void *)&_encoder.getFloatQuantization();
+    } else if (name == Property::ParallelCompression) {
+        return (void *)&_encoder.getParallelCompression();
+    } else if (name == Property::MeshCompression) {
+        return (void *)&_encoder.getMeshCompression();
+    } else if (name == Property::BinarySingleFields) {
+        return (void *)&_binarySingleFields;
+    } else if (name == Property::AttributeValueTableLimit) {
+        return (void *)&_attributeValueTableLimit;
+    } else if (name == Property::AttributeValueTableStatistics) {
+        return (void *)&_encoder.getAttributeValueTableStatistics();
+    } else if (name == Property::ArrayDeduplication) {
+        return (void *)&_arrayDeduplication;
+    } else if (name == Property::ArrayDeduplicationStatistics) {
+        return (void *)&_deduplicator->getStatistics();
     }
     return 0;
 }
@@ -89,23 +166,62 @@ void *X3DWriterFI::getProperty(const char *const name) const {
 int X3DWriterFI::openFile(const char *file) {
     this->closeFile();
 
+    _stream.clear();
     _stream.open(file, ios::out | ios::binary);
-    if (!_stream.fail()) {
-        _encoder.reset();
-        return 1;
-    }
+    if (!_stream.fail())
+        return this->open(_stream);
     return 0;
 }
 
+//----------------------------------------------------------------------------
+int X3DWriterFI::openStream(std::ostream &stream) {
+    this->closeFile();
+
+    if (!stream.good())
+        return 0;
+    return this->open(stream);
+}
+
+//----------------------------------------------------------------------------
+int X3DWriterFI::openSink(X3DOutputSink *sink) {
+    this->closeFile();
+
+    if (!sink)
+        return 0;
+    _sinkBuffer = new SinkStreamBuffer(*sink);
+    _sinkStream = new std::ostream(_sinkBuffer);
+    return this->open(*_sinkStream);
+}
+
+//----------------------------------------------------------------------------
+int X3DWriterFI::open(std::ostream &stream) {
+    _output = &stream;
+    // Only the file opened by the writer is overwritten by a new document
+    _encoder.setStream(stream, &stream == &_stream);
+    _encoder.reset();
+    return 1;
+}
+
 //----------------------------------------------------------------------------
 void X3DWriterFI::closeFile() {
+    if (!_output)
+        return;
+
+    _encoder.flush();
     if (_stream.is_open())
         _stream.close();
+    delete _sinkStream;
+    delete _sinkBuffer;
+    _sinkStream = NULL;
+    _sinkBuffer = NULL;
+    _output = NULL;
+    _encoder.setStream(_stream, true);
 }
 
 //----------------------------------------------------------------------------
 void X3DWriterFI::startDocument() {
     _encoder.reset();
+    _deduplicator->reset();
     _encoder.encodeHeader(false);
     _encoder.encodeInitialVocabulary();
 }
@@ -118,6 +234,9 @@ void X3DWriterFI::endDocument() {
 
 //----------------------------------------------------------------------------
 void X3DWriterFI::startNode(int elementID) {
+    if (_deduplicator->startNode(elementID))
+        return;
+
     if (!this->_infoStack->empty()) {
         this->checkNode(false);
         if (this->_isLineFeedEncodingOn) {
@@ -134,6 +253,9 @@ void X3DWriterFI::startNode(int elementID) {
 
 //----------------------------------------------------------------------------
 void X3DWriterFI::endNode() {
+    if (_deduplicator->endNode())
+        return;
+
     assert(!this->_infoStack->empty());
     this->checkNode(false);
     if (this->_isLineFeedEncodingOn) {
@@ -142,10 +264,10 @@ void X3DWriterFI::endNode() {
     if (!this->_infoStack->back().attributesTerminated) {
         //cout << "Terminated in EndNode: could be wrong" << endl;
         // ITU C.3.6.2: End of attribute
-        _encoder.putBits("1111");
+        _encoder.putBits(0xF, 4);  // 1111
     }
     // ITU C.3.8: The four bits '1111' (termination) are appended.
-    _encoder.putBits("1111");
+    _encoder.putBits(0xF, 4);  // 1111
     this->_infoStack->pop_back();
 }
 
@@ -171,18 +293,29 @@ void X3DWriterFI::checkNode(bool callerIsAttribute) {
     // Element has attributes and childs
     else if (!callerIsAttribute && !this->_infoStack->back().attributesTerminated) {
         // ITU C.3.6.2: End of attribute
-        _encoder.putBits("1111");
+        _encoder.putBits(0xF, 4);  // 1111
         this->_infoStack->back().attributesTerminated = true;
     }
 }
 
 //----------------------------------------------------------------------------
-void X3DWriterFI::startAttribute(int attributeID, bool literal, bool addToTable) {
+void X3DWriterFI::encodeAttributeName(int attributeID) {
     this->checkNode();
     // ITU C.3.6.1: Start of attribute
     _encoder.putBit(0);
     // ITU C.4.3 The value of qualified-name is encoded as described in C.17.
     _encoder.encodeInteger2(attributeID + 1);
+}
+
+//----------------------------------------------------------------------------
+void X3DWriterFI::setAttributeValue(int attributeID, const std::string &value, bool addToTable) {
+    this->encodeAttributeName(attributeID);
+    _encoder.encodeNonIdentifyingStringOrIndex1(value, addToTable);
+}
+
+//----------------------------------------------------------------------------
+void X3DWriterFI::startAttribute(int attributeID, bool literal, bool addToTable) {
+    this->encodeAttributeName(attributeID);
 
     // ITU C.14.3: If the alternative literal-character-string is present,
     //then the bit '0' (discriminant) is appended
@@ -203,18 +336,18 @@ void X3DWriterFI::endAttribute() {
 
 //----------------------------------------------------------------------------
 void X3DWriterFI::setSFVec3f(int attributeID, float x, float y, float z) {
-    std::ostringstream ss;
-    this->startAttribute(attributeID, true, false);
-    ss << x << " " << y << " " << z;
-    _encoder.encodeCharacterString3(ss.str());
+    float values[] = {x, y, z};
+    if (_deduplicator->setFloats(X3DNodeDeduplicator::SFVec3f, attributeID, values, 3))
+        return;
+    this->setSingleFloats(attributeID, values, 3);
 }
 
 //----------------------------------------------------------------------------
 void X3DWriterFI::setSFVec2f(int attributeID, float s, float t) {
-    std::ostringstream ss;
-    this->startAttribute(attributeID, true, false);
-    ss << s << " " << t;
-    _encoder.encodeCharacterString3(ss.str());
+    float values[] = {s, t};
+    if (_deduplicator->setFloats(X3DNodeDeduplicator::SFVec2f, attributeID, values, 2))
+        return;
+    this->setSingleFloats(attributeID, values, 2);
 }
 
 //----------------------------------------------------------------------------
@@ -224,39 +357,83 @@ void X3DWriterFI::setSFColor(int attributeID, float r, float g, float b) {
 
 //----------------------------------------------------------------------------
 void X3DWriterFI::setSFRotation(int attributeID, float x, float y, float z, float angle) {
+    float values[] = {x, y, z, angle};
+    if (_deduplicator->setFloats(X3DNodeDeduplicator::SFRotation, attributeID, values, 4))
+        return;
+    this->setSingleFloats(attributeID, values, 4);
+}
+
+//----------------------------------------------------------------------------
+void X3DWriterFI::setSingleFloats(int attributeID, const float *values, size_t size) {
+    if (_binarySingleFields) {
+        this->startAttribute(attributeID, true, false);
+        // Always the built-in algorithm, the X3DFIAttributes read it without a copy
+        _encoder.FI::FIEncoder::encodeAttributeFloatArray(values, size);
+        return;
+    }
+
+    // Xj3D writes out single value fields in string encoding
     std::ostringstream ss;
-    this->startAttribute(attributeID, true, false);
-    ss << x << " " << y << " " << z << " " << angle;
-    _encoder.encodeCharacterString3(ss.str());
+    for (size_t i = 0; i < size; i++)
+        ss << (i ? " " : "") << values[i];
+    std::string value = ss.str();
+    this->setAttributeValue(attributeID, value, _attributeValueTableLimit && value.size() <= MAX_TABLE_VALUE_LENGTH);
 }
 
 void X3DWriterFI::setMFFloat(int attributeID, const std::vector<float> &values) {
-    this->startAttribute(attributeID, true, false);
-    _encoder.encodeAttributeFloatArray(&(values.front()), values.size());
+    if (_deduplicator->setFloats(X3DNodeDeduplicator::MFFloat, attributeID, values.empty() ? NULL : &values.front(), values.size()))
+        return;
+    this->setFloatArray(attributeID, values, 1);
 }
 
 //----------------------------------------------------------------------------
 void X3DWriterFI::setMFColor(int attributeID, const std::vector<float> &values) {
-    this->setMFFloat(attributeID, values);
+    if (_deduplicator->setFloats(X3DNodeDeduplicator::MFColor, attributeID, values.empty() ? NULL : &values.front(), values.size()))
+        return;
+    this->setFloatArray(attributeID, values, 3);
 }
 
 //----------------------------------------------------------------------------
 void X3DWriterFI::setMFRotation(int attributeID, const std::vector<float> &values) {
-    this->setMFFloat(attributeID, values);
+    if (_deduplicator->setFloats(X3DNodeDeduplicator::MFRotation, attributeID, values.empty() ? NULL : &values.front(), values.size()))
+        return;
+    this->setFloatArray(attributeID, values, 4);
 }
 
 //----------------------------------------------------------------------------
 void X3DWriterFI::setMFVec3f(int attributeID, const std::vector<float> &values) {
-    this->setMFFloat(attributeID, values);
+    if (_deduplicator->setFloats(X3DNodeDeduplicator::MFVec3f, attributeID, values.empty() ? NULL : &values.front(), values.size()))
+        return;
+
+    // Incomplete points are written with the regular float encoding
+    size_t depth = this->_infoStack->size();
+    if (_encoder.getMeshCompression().coordinateBits && attributeID == ID::point && values.size() % 3 == 0 && depth >= 2 &&
+        this->_infoStack->back().nodeId == ID::Coordinate && !(*this->_infoStack)[depth - 2].meshIndex.empty()) {
+        const NodeInfo &mesh = (*this->_infoStack)[depth - 2];
+        this->startAttribute(attributeID, true, false);
+        _encoder.encodeAttributeMeshCoordinate(values.empty() ? NULL : &values.front(), values.size(), mesh.meshIndex, mesh.faceSize);
+        return;
+    }
+    this->setFloatArray(attributeID, values, 3);
 }
 
 //----------------------------------------------------------------------------
 void X3DWriterFI::setMFVec2f(int attributeID, const std::vector<float> &values) {
-    this->setMFFloat(attributeID, values);
+    if (_deduplicator->setFloats(X3DNodeDeduplicator::MFVec2f, attributeID, values.empty() ? NULL : &values.front(), values.size()))
+        return;
+    this->setFloatArray(attributeID, values, 2);
+}
+
+//----------------------------------------------------------------------------
+void X3DWriterFI::setFloatArray(int attributeID, const std::vector<float> &values, unsigned int stride) {
+    this->startAttribute(attributeID, true, false);
+    _encoder.encodeAttributeFloatArray(&(values.front()), values.size(), stride);
 }
 
 //----------------------------------------------------------------------------
 void X3DWriterFI::setSFImage(int attributeID, const std::vector<int> &values) {
+    if (_deduplicator->setInts(X3DNodeDeduplicator::SFImage, attributeID, values.empty() ? NULL : &values.front(), values.size()))
+        return;
     this->startAttribute(attributeID, true, false);
     _encoder.encodeAttributeIntegerArray(&values.front(), values.size());
 }
@@ -264,59 +441,76 @@ void X3DWriterFI::setSFImage(int attributeID, const std::vector<int> &values) {
 
 //----------------------------------------------------------------------------
 void X3DWriterFI::setSFInt32(int attributeID, int iValue) {
-    std::ostringstream ss;
-    this->startAttribute(attributeID, true, false);
+    if (_deduplicator->setInts(X3DNodeDeduplicator::SFInt32, attributeID, &iValue, 1))
+        return;
+    if (_binarySingleFields) {
+        this->startAttribute(attributeID, true, false);
+        _encoder.FI::FIEncoder::encodeAttributeIntegerArray(&iValue, 1);
+        return;
+    }
 
-    // Xj3D writes out single value fields in string encoding. Expected:
-    //FIEncoderFunctions::EncodeFloatFI<float>(this->Writer, &value, 1);
+    // Xj3D writes out single value fields in string encoding
+    std::ostringstream ss;
     ss << iValue;
-    _encoder.encodeCharacterString3(ss.str());
+    this->setAttributeValue(attributeID, ss.str(), _attributeValueTableLimit != 0);
 }
 
 //----------------------------------------------------------------------------
 void X3DWriterFI::setMFInt32(int attributeID, const std::vector<int> &values) {
+    if (_deduplicator->setInts(X3DNodeDeduplicator::MFInt32, attributeID, values.empty() ? NULL : &values.front(), values.size()))
+        return;
+
+    NodeInfo &node = this->_infoStack->back();
+    bool isMeshIndex = (node.nodeId == ID::IndexedFaceSet && attributeID == ID::coordIndex) || (node.nodeId == ID::IndexedTriangleSet && attributeID == ID::index);
     this->startAttribute(attributeID, true, false);
+    if (_encoder.getMeshCompression().coordinateBits && isMeshIndex && !values.empty()) {
+        _encoder.encodeAttributeMeshIndex(&values.front(), values.size());
+        node.meshIndex = values;
+        node.faceSize = node.nodeId == ID::IndexedTriangleSet ? 3 : 0;
+        return;
+    }
     _encoder.encodeAttributeIntegerArray(&values.front(), values.size());
 }
 
 //----------------------------------------------------------------------------
 void X3DWriterFI::setSFFloat(int attributeID, float fValue) {
-    std::ostringstream ss;
-
-    this->startAttribute(attributeID, true, false);
-
-    // Xj3D writes out single value fields in string encoding. Expected:
-    //FIEncoderFunctions::EncodeFloatFI<float>(this->Writer, &value, 1);
-    ss << fValue;
-    _encoder.encodeCharacterString3(ss.str());
+    if (_deduplicator->setFloats(X3DNodeDeduplicator::SFFloat, attributeID, &fValue, 1))
+        return;
+    this->setSingleFloats(attributeID, &fValue, 1);
 }
 
 //----------------------------------------------------------------------------
 void X3DWriterFI::setSFBool(int attributeID, bool bValue) {
+    int value = bValue;
+    if (_deduplicator->setInts(X3DNodeDeduplicator::SFBool, attributeID, &value, 1))
+        return;
     this->startAttribute(attributeID, false);
     _encoder.encodeInteger2(bValue ? 2 : 1);
 }
 
 //----------------------------------------------------------------------------
-/*void X3DWriterFI::setMFBool(int attributeID, std::vector<bool>& values)
-{
-  // ok?
-  this->startAttribute(attributeID, false);
-
-  // TODO: Implement standard FI boolean encoder (s FI 10.7)
-  for(unsigned int i = 0; i < 1; i++)
-    _encoder.EncodeInteger2(this->Writer, values[i] ? 2 : 1);
-
-}*/
+void X3DWriterFI::setMFBool(int attributeID, const std::vector<bool> &values) {
+    if (_deduplicator->setBools(attributeID, values))
+        return;
+    // The algorithm needs at least one value, an empty field is the default
+    if (values.empty())
+        return;
+    this->startAttribute(attributeID, true, false);
+    _encoder.encodeAttributeBooleanArray(values);
+}
 
 //----------------------------------------------------------------------------
 void X3DWriterFI::setSFString(int attributeID, const std::string &s) {
-    this->startAttribute(attributeID, true, true);
-    _encoder.encodeCharacterString3(s);
+    if (_deduplicator->setStrings(X3DNodeDeduplicator::SFString, attributeID, &s, 1))
+        return;
+    this->setAttributeValue(attributeID, s, true);
 }
 
 //----------------------------------------------------------------------------
 void X3DWriterFI::setMFString(int attributeID, const std::vector<std::string> &strings) {
+    if (_deduplicator->setStrings(X3DNodeDeduplicator::MFString, attributeID, strings.empty() ? NULL : &strings.front(), strings.size()))
+        return;
+
     std::ostringstream sTemp;
 
     for (unsigned int i = 0; i < strings.size(); i++) {
@@ -324,13 +518,14 @@ void X3DWriterFI::setMFString(int attributeID, const std::vector<std::string> &s
         if (i < (strings.size() - 1))
             sTemp << " ";
     }
-    this->startAttribute(attributeID, true, true);
-    _encoder.encodeCharacterString3(sTemp.str());
+    this->setAttributeValue(attributeID, sTemp.str(), true);
 }
 
 
 //----------------------------------------------------------------------------
 void X3DWriterFI::flush() {
+    if (_output)
+        _encoder.flush();
 }
 
 }  // namespace XIOT
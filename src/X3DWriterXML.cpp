@@ -1,13 +1,38 @@
 #include <xiot/X3DWriterXML.h>
 
+#include <cstdarg>
 #include <cstring>
 
+#include <xiot/X3DNodeDeduplicator.h>
+#include <xiot/X3DOutputSink.h>
 #include <xiot/X3DTypes.h>
 
 using namespace XIOT;
 
+namespace {
+
+/// The output is collected and passed to the sink in large blocks
+const size_t BUFFER_SIZE = 65536;
+
+/// Writes to a file opened by the writer
+class FileSink : public X3DOutputSink {
+  public:
+    FileSink(FILE *file) : _file(file) {}
+    ~FileSink() { fclose(_file); }
+
+    virtual void write(const char *data, size_t size) { fwrite(data, 1, size, _file); }
+    virtual void flush() { fflush(_file); }
+
+  private:
+    FILE *_file;
+};
+
+}  // namespace
+
 X3DWriterXML::~X3DWriterXML() {
+    this->closeFile();
     delete this->InfoStack;
+    delete this->Deduplicator;
 }
 
 //-----------------------------------------------------------------------------
@@ -16,36 +41,77 @@ X3DWriterXML::X3DWriterXML() {
     this->Depth = 0;
     this->ActTab = "";
     this->type = X3DXML;
-    this->OutputStream = NULL;
-    X3DTypes::initMaps();
+    this->OutputSink = NULL;
+    this->OwnedSink = NULL;
+    this->Buffer.resize(BUFFER_SIZE);
+    this->BufferPos = 0;
+    this->Deduplicator = new X3DNodeDeduplicator(*this);
+    this->ArrayDeduplication = 0;
 }
 
-bool X3DWriterXML::setProperty(const char *const, void *) {
+bool X3DWriterXML::setProperty(const char *const name, void *value) {
+    if (name == Property::ArrayDeduplication) {
+        // NULL switches the deduplication off
+        this->ArrayDeduplication = value ? *static_cast<size_t *>(value) : 0;
+        this->Deduplicator->setMinimumSize(this->ArrayDeduplication);
+        return true;
+    }
     return false;
 }
 
-void *X3DWriterXML::getProperty(const char *const) const {
+void *X3DWriterXML::getProperty(const char *const name) const {
+    if (name == Property::ArrayDeduplication) {
+        return (void *)&this->ArrayDeduplication;
+    } else if (name == Property::ArrayDeduplicationStatistics) {
+        return (void *)&this->Deduplicator->getStatistics();
+    }
     return 0;
 }
 
 int X3DWriterXML::openFile(const char *file) {
     this->closeFile();
-    this->OutputStream = fopen(file, "w");
+    FILE *outputFile = fopen(file, "w");
+    if (!outputFile)
+        return 0;
 
-    return ((this->OutputStream == NULL) ? 0 : 1);
+    this->OwnedSink = new FileSink(outputFile);
+    this->OutputSink = this->OwnedSink;
+    return 1;
+}
+
+//----------------------------------------------------------------------------
+int X3DWriterXML::openStream(std::ostream &stream) {
+    this->closeFile();
+    if (!stream.good())
+        return 0;
+
+    this->OwnedSink = new X3DStreamSink(stream);
+    this->OutputSink = this->OwnedSink;
+    return 1;
+}
+
+//----------------------------------------------------------------------------
+int X3DWriterXML::openSink(X3DOutputSink *sink) {
+    this->closeFile();
+    this->OutputSink = sink;
+    return sink ? 1 : 0;
 }
 
 //----------------------------------------------------------------------------
 void X3DWriterXML::closeFile() {
-    if (this->OutputStream) {
-        fclose(OutputStream);
+    if (this->OutputSink) {
+        this->flush();
+        delete this->OwnedSink;
+        this->OwnedSink = NULL;
+        this->OutputSink = NULL;
     }
 }
 
 //-----------------------------------------------------------------------------
 void X3DWriterXML::startDocument() {
     this->Depth = 0;
-    fprintf(this->OutputStream, "<?xml version=\"1.0\" encoding =\"UTF-8\"?>\n\n");
+    this->Deduplicator->reset();
+    this->print("<?xml version=\"1.0\" encoding =\"UTF-8\"?>\n\n");
 }
 
 //-----------------------------------------------------------------------------
@@ -55,31 +121,37 @@ void X3DWriterXML::endDocument() {
 
 //-----------------------------------------------------------------------------
 void X3DWriterXML::startNode(int elementID) {
+    if (this->Deduplicator->startNode(elementID))
+        return;
+
     // End last tag, if this is the first child
     if (!this->InfoStack->empty()) {
         if (!this->InfoStack->back().endTagWritten) {
-            fprintf(this->OutputStream, ">\n");
+            this->print(">\n");
             this->InfoStack->back().endTagWritten = true;
         }
     }
 
     this->InfoStack->push_back(XMLInfo(elementID));
 
-    fprintf(this->OutputStream, "%s<%s", this->ActTab.c_str(), X3DTypes::getElementByID(elementID));
+    this->print("%s<%s", this->ActTab.c_str(), X3DTypes::getElementByID(elementID));
     this->addDepth();
 }
 
 //-----------------------------------------------------------------------------
 void X3DWriterXML::endNode() {
+    if (this->Deduplicator->endNode())
+        return;
+
     assert(!this->InfoStack->empty());
     this->subDepth();
     int elementID = this->InfoStack->back().elementId;
 
     // There were no childs
     if (!this->InfoStack->back().endTagWritten) {
-        fprintf(this->OutputStream, "/>\n");
+        this->print("/>\n");
     } else {
-        fprintf(this->OutputStream, "%s</%s>\n", this->ActTab.c_str(), X3DTypes::getElementByID(elementID));
+        this->print("%s</%s>\n", this->ActTab.c_str(), X3DTypes::getElementByID(elementID));
     }
 
     this->InfoStack->pop_back();
@@ -87,32 +159,47 @@ void X3DWriterXML::endNode() {
 
 //-----------------------------------------------------------------------------
 void X3DWriterXML::setSFFloat(int attributeID, float fValue) {
-    fprintf(this->OutputStream, " %s=\"%g\"", X3DTypes::getAttributeByID(attributeID), fValue);
+    if (this->Deduplicator->setFloats(X3DNodeDeduplicator::SFFloat, attributeID, &fValue, 1))
+        return;
+    this->print(" %s=\"%g\"", X3DTypes::getAttributeByID(attributeID), fValue);
 }
 
 //-----------------------------------------------------------------------------
 void X3DWriterXML::setSFInt32(int attributeID, int iValue) {
-    fprintf(this->OutputStream, " %s=\"%i\"", X3DTypes::getAttributeByID(attributeID), iValue);
+    if (this->Deduplicator->setInts(X3DNodeDeduplicator::SFInt32, attributeID, &iValue, 1))
+        return;
+    this->print(" %s=\"%i\"", X3DTypes::getAttributeByID(attributeID), iValue);
 }
 
 //-----------------------------------------------------------------------------
 void X3DWriterXML::setSFBool(int attributeID, bool bValue) {
-    fprintf(this->OutputStream, " %s=\"%s\"", X3DTypes::getAttributeByID(attributeID), (bValue ? "true" : "false"));
+    int value = bValue;
+    if (this->Deduplicator->setInts(X3DNodeDeduplicator::SFBool, attributeID, &value, 1))
+        return;
+    this->print(" %s=\"%s\"", X3DTypes::getAttributeByID(attributeID), (bValue ? "true" : "false"));
 }
 
 //-----------------------------------------------------------------------------
 void X3DWriterXML::setSFVec3f(int attributeID, float x, float y, float z) {
-    fprintf(this->OutputStream, " %s=\"%g %g %g\"", X3DTypes::getAttributeByID(attributeID), x, y, z);
+    float values[] = {x, y, z};
+    if (this->Deduplicator->setFloats(X3DNodeDeduplicator::SFVec3f, attributeID, values, 3))
+        return;
+    this->print(" %s=\"%g %g %g\"", X3DTypes::getAttributeByID(attributeID), x, y, z);
 }
 
 //-----------------------------------------------------------------------------
 void X3DWriterXML::setSFVec2f(int attributeID, float s, float t) {
-    fprintf(this->OutputStream, " %s=\"%g %g\"", X3DTypes::getAttributeByID(attributeID), s, t);
+    float values[] = {s, t};
+    if (this->Deduplicator->setFloats(X3DNodeDeduplicator::SFVec2f, attributeID, values, 2))
+        return;
+    this->print(" %s=\"%g %g\"", X3DTypes::getAttributeByID(attributeID), s, t);
 }
 
 //-----------------------------------------------------------------------------
 void X3DWriterXML::setSFImage(int attributeID, const std::vector<int> &values) {
-    fprintf(this->OutputStream, " %s=\"\n%s", X3DTypes::getAttributeByID(attributeID), this->ActTab.c_str());
+    if (this->Deduplicator->setInts(X3DNodeDeduplicator::SFImage, attributeID, values.empty() ? NULL : &values.front(), values.size()))
+        return;
+    this->print(" %s=\"\n%s", X3DTypes::getAttributeByID(attributeID), this->ActTab.c_str());
 
     unsigned int i = 0;
 
@@ -121,25 +208,25 @@ void X3DWriterXML::setSFImage(int attributeID, const std::vector<int> &values) {
     //this->OutputStream << values[0] << " "; // width
     //this->OutputStream << values[1] << " "; // height
     //int bpp = values[2]; this->OutputStream << bpp << "\n"; // bpp
-    fprintf(this->OutputStream, "%i %i %i\n", values[0], values[1], values[2]);
+    this->print("%i %i %i\n", values[0], values[1], values[2]);
 
     i = 3;
     unsigned int j = 0;
 
     while (i < values.size()) {
         sprintf(buffer, "0x%.8x", values[i]);
-        fwrite(buffer, 1, strlen(buffer), this->OutputStream);
+        this->write(buffer, strlen(buffer));
 
         if (j % (8 * values[2])) {
-            fprintf(this->OutputStream, " ");
+            this->print(" ");
         } else {
-            fprintf(this->OutputStream, "\n");
+            this->print("\n");
         }
         i++;
         j += values[2];
     }
 
-    fprintf(this->OutputStream, "\"");
+    this->print("\"");
 }
 
 //-----------------------------------------------------------------------------
@@ -150,46 +237,55 @@ void X3DWriterXML::setSFColor(int attributeID, float r, float g, float b) {
 //-----------------------------------------------------------------------------
 // wieso -angle?
 void X3DWriterXML::setSFRotation(int attributeID, float x, float y, float z, float angle) {
-    fprintf(this->OutputStream, " %s=\"%g %g %g %g\"", X3DTypes::getAttributeByID(attributeID), x, y, z, angle);
+    float values[] = {x, y, z, angle};
+    if (this->Deduplicator->setFloats(X3DNodeDeduplicator::SFRotation, attributeID, values, 4))
+        return;
+    this->print(" %s=\"%g %g %g %g\"", X3DTypes::getAttributeByID(attributeID), x, y, z, angle);
 }
 
 //-----------------------------------------------------------------------------
 void X3DWriterXML::setSFString(int attributeID, const std::string &s) {
-    fprintf(this->OutputStream, " %s=\"%s\"", X3DTypes::getAttributeByID(attributeID), s.c_str());
+    if (this->Deduplicator->setStrings(X3DNodeDeduplicator::SFString, attributeID, &s, 1))
+        return;
+    this->print(" %s=\"%s\"", X3DTypes::getAttributeByID(attributeID), s.c_str());
 }
 
 //-----------------------------------------------------------------------------
 void X3DWriterXML::setMFFloat(int attributeID, const std::vector<float> &values) {
-    fprintf(this->OutputStream, " %s=\"\n%s", X3DTypes::getAttributeByID(attributeID), this->ActTab.c_str());
+    if (this->Deduplicator->setFloats(X3DNodeDeduplicator::MFFloat, attributeID, values.empty() ? NULL : &values.front(), values.size()))
+        return;
+    this->print(" %s=\"\n%s", X3DTypes::getAttributeByID(attributeID), this->ActTab.c_str());
 
     unsigned int i = 0;
     while (i < values.size()) {
-        fprintf(this->OutputStream, "%g", values[i]);
+        this->print("%g", values[i]);
         if ((i + 1) % 3) {
-            fprintf(this->OutputStream, " ");
+            this->print(" ");
         } else {
-            fprintf(this->OutputStream, ",\n%s", this->ActTab.c_str());
+            this->print(",\n%s", this->ActTab.c_str());
         }
         i++;
     }
-    fprintf(this->OutputStream, "\"");
+    this->print("\"");
 }
 
 //-----------------------------------------------------------------------------
 void X3DWriterXML::setMFRotation(int attributeID, const std::vector<float> &values) {
-    fprintf(this->OutputStream, " %s=\"\n%s", X3DTypes::getAttributeByID(attributeID), this->ActTab.c_str());
+    if (this->Deduplicator->setFloats(X3DNodeDeduplicator::MFRotation, attributeID, values.empty() ? NULL : &values.front(), values.size()))
+        return;
+    this->print(" %s=\"\n%s", X3DTypes::getAttributeByID(attributeID), this->ActTab.c_str());
 
     unsigned int i = 0;
     while (i < values.size()) {
-        fprintf(this->OutputStream, "%g", values[i]);
+        this->print("%g", values[i]);
         if ((i + 1) % 4) {
-            fprintf(this->OutputStream, " ");
+            this->print(" ");
         } else {
-            fprintf(this->OutputStream, ",\n%s", this->ActTab.c_str());
+            this->print(",\n%s", this->ActTab.c_str());
         }
         i++;
     }
-    fprintf(this->OutputStream, "\"");
+    this->print("\"");
 }
 
 //-----------------------------------------------------------------------------
@@ -200,77 +296,125 @@ void X3DWriterXML::setMFColor(int attributeID, const std::vector<float> &values)
 
 //-----------------------------------------------------------------------------
 void X3DWriterXML::setMFInt32(int attributeID, const std::vector<int> &values) {
-    fprintf(this->OutputStream, " %s=\"\n%s", X3DTypes::getAttributeByID(attributeID), this->ActTab.c_str());
+    if (this->Deduplicator->setInts(X3DNodeDeduplicator::MFInt32, attributeID, values.empty() ? NULL : &values.front(), values.size()))
+        return;
+    this->print(" %s=\"\n%s", X3DTypes::getAttributeByID(attributeID), this->ActTab.c_str());
 
     unsigned int i = 0;
     while (i < values.size()) {
-        fprintf(this->OutputStream, "%i ", values[i]);
+        this->print("%i ", values[i]);
         if (values[i] == -1) {
-            fprintf(this->OutputStream, "\n%s", this->ActTab.c_str());
+            this->print("\n%s", this->ActTab.c_str());
         }
         i++;
     }
-    fprintf(this->OutputStream, "\"");
-}
-
-// Not implemented for FI encoding yet
-/*void X3DWriterXML::setMFBool(int attributeID, std::vector<bool>& values)
-{
-  fprintf(this->OutputStream, " %s=\"", X3DTypes::getAttributeByID(attributeID));
-  for(unsigned int i = 0; i < values.size(); i++)
-  {
-	if (i != 0)
-		fprintf(this->OutputStream, " ");
-    if (values[i])
-		fprintf(this->OutputStream, "true");
-	else
-		fprintf(this->OutputStream, "false");
-  }
-  fprintf(this->OutputStream, "\"");
-}*/
+    this->print("\"");
+}
+
+void X3DWriterXML::setMFBool(int attributeID, const std::vector<bool> &values) {
+    if (this->Deduplicator->setBools(attributeID, values))
+        return;
+    this->print(" %s=\"", X3DTypes::getAttributeByID(attributeID));
+    for (unsigned int i = 0; i < values.size(); i++) {
+        if (i != 0)
+            this->print(" ");
+        this->print("%s", values[i] ? "true" : "false");
+    }
+    this->print("\"");
+}
 
 //-----------------------------------------------------------------------------
 void X3DWriterXML::setMFVec2f(int attributeID, const std::vector<float> &values) {
-    fprintf(this->OutputStream, " %s=\"\n", X3DTypes::getAttributeByID(attributeID));
+    if (this->Deduplicator->setFloats(X3DNodeDeduplicator::MFVec2f, attributeID, values.empty() ? NULL : &values.front(), values.size()))
+        return;
+    this->print(" %s=\"\n", X3DTypes::getAttributeByID(attributeID));
 
     assert((values.size() % 2) == 0);
 
     for (unsigned int i = 0; i < values.size(); i += 2) {
-        fprintf(this->OutputStream, "%s%g %g,\n", this->ActTab.c_str(), values[i], values[i + 1]);
+        this->print("%s%g %g,\n", this->ActTab.c_str(), values[i], values[i + 1]);
     }
 
-    fprintf(this->OutputStream, "%s\"", this->ActTab.c_str());
+    this->print("%s\"", this->ActTab.c_str());
 }
 
 //-----------------------------------------------------------------------------
 void X3DWriterXML::setMFVec3f(int attributeID, const std::vector<float> &values) {
-    fprintf(this->OutputStream, " %s=\"\n", X3DTypes::getAttributeByID(attributeID));
+    if (this->Deduplicator->setFloats(X3DNodeDeduplicator::MFVec3f, attributeID, values.empty() ? NULL : &values.front(), values.size()))
+        return;
+    this->print(" %s=\"\n", X3DTypes::getAttributeByID(attributeID));
 
     assert((values.size() % 3) == 0);
 
     for (unsigned int i = 0; i < values.size(); i += 3) {
-        fprintf(this->OutputStream, "%s%g %g %g,\n", this->ActTab.c_str(), values[i], values[i + 1], values[i + 2]);
+        this->print("%s%g %g %g,\n", this->ActTab.c_str(), values[i], values[i + 1], values[i + 2]);
     }
 
-    fprintf(this->OutputStream, "%s\"", this->ActTab.c_str());
+    this->print("%s\"", this->ActTab.c_str());
 }
 
 //-----------------------------------------------------------------------------
 void X3DWriterXML::setMFString(int attributeID, const std::vector<std::string> &strings) {
-    fprintf(this->OutputStream, " %s='", X3DTypes::getAttributeByID(attributeID));
+    if (this->Deduplicator->setStrings(X3DNodeDeduplicator::MFString, attributeID, strings.empty() ? NULL : &strings.front(), strings.size()))
+        return;
+    this->print(" %s='", X3DTypes::getAttributeByID(attributeID));
 
     for (unsigned int i = 0; i < strings.size(); i++) {
-        fprintf(this->OutputStream, "\"%s\"", strings[i].c_str());
+        this->print("\"%s\"", strings[i].c_str());
         if (i < (strings.size() - 1))
-            fprintf(this->OutputStream, " ");
+            this->print(" ");
     }
 
-    fprintf(this->OutputStream, "'");
+    this->print("'");
 }
 
 //-----------------------------------------------------------------------------
 void X3DWriterXML::flush() {
-    fflush(this->OutputStream);
+    this->flushBuffer();
+    if (this->OutputSink)
+        this->OutputSink->flush();
+}
+
+//-----------------------------------------------------------------------------
+void X3DWriterXML::print(const char *format, ...) {
+    va_list args;
+    size_t space = this->Buffer.size() - this->BufferPos;
+    va_start(args, format);
+    int length = vsnprintf(&this->Buffer[0] + this->BufferPos, space, format, args);
+    va_end(args);
+    if (length < 0 || static_cast<size_t>(length) < space) {
+        this->BufferPos += length < 0 ? 0 : length;
+        return;
+    }
+
+    // Did not fit, long values grow the buffer
+    this->flushBuffer();
+    if (static_cast<size_t>(length) >= this->Buffer.size())
+        this->Buffer.resize(length + 1);
+    va_start(args, format);
+    vsnprintf(&this->Buffer[0], this->Buffer.size(), format, args);
+    va_end(args);
+    this->BufferPos = length;
+}
+
+//-----------------------------------------------------------------------------
+void X3DWriterXML::write(const char *data, size_t size) {
+    if (this->BufferPos + size > this->Buffer.size())
+        this->flushBuffer();
+    if (size >= this->Buffer.size()) {
+        if (this->OutputSink)
+            this->OutputSink->write(data, size);
+        return;
+    }
+    memcpy(&this->Buffer[this->BufferPos], data, size);
+    this->BufferPos += size;
+}
+
+//-----------------------------------------------------------------------------
+void X3DWriterXML::flushBuffer() {
+    if (this->BufferPos && this->OutputSink)
+        this->OutputSink->write(&this->Buffer[0], this->BufferPos);
+    this->BufferPos = 0;
 }
 
 //-----------------------------------------------------------------------------
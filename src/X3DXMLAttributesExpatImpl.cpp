@@ -116,6 +116,10 @@ void X3DXMLAttributes::getSFImage(int index, SFImage &value) const {
 }
 
 // Multi Field
+void X3DXMLAttributes::getMFBool(int index, MFBool &value) const {
+    const char *sValue = _impl->_attributes.at(index)._value;
+    X3DDataTypeFactory::getMFBoolFromString(sValue, value);
+}
 void X3DXMLAttributes::getMFFloat(int index, MFFloat &value) const {
     const char *sValue = _impl->_attributes.at(index)._value;
     X3DDataTypeFactory::getMFFloatFromString(sValue, value);
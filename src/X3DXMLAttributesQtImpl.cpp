@@ -85,6 +85,9 @@ void X3DXMLAttributes::getSFImage(int index, SFImage &value) const {
 }
 
 // Multi Field
+void X3DXMLAttributes::getMFBool(int index, MFBool &value) const {
+    X3DDataTypeFactory::getMFBoolFromString(GET_ATTR_VAL_STR(index), value);
+}
 void X3DXMLAttributes::getMFFloat(int index, MFFloat &value) const {
     X3DDataTypeFactory::getMFFloatFromString(GET_ATTR_VAL_STR(index), value);
 }
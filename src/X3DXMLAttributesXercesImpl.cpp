@@ -117,6 +117,11 @@ void X3DXMLAttributes::getSFImage(int index, SFImage &value) const {
 }
 
 // Multi Field
+void X3DXMLAttributes::getMFBool(int index, MFBool &value) const {
+    char *sValue = XMLString::transcode(_impl->_attributes->getValue(index));
+    X3DDataTypeFactory::getMFBoolFromString(sValue, value);
+    XMLString::release(&sValue);
+}
 void X3DXMLAttributes::getMFFloat(int index, MFFloat &value) const {
     char *sValue = XMLString::transcode(_impl->_attributes->getValue(index));
     X3DDataTypeFactory::getMFFloatFromString(sValue, value);
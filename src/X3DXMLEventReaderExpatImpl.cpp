@@ -0,0 +1,233 @@
+#include <xiot/X3DParseException.h>
+#include <xiot/X3DTypes.h>
+#include <xiot/X3DXMLAttributes.h>
+#include <xiot/X3DXMLEventReader.h>
+
+#include "expat/lib/expat.h"
+
+#include <cassert>
+#include <deque>
+#include <fstream>
+#include <string>
+#include <vector>
+
+namespace XIOT {
+
+struct ExpatEvent {
+    X3DEventReader::EventType _type;
+    std::string _name;
+    /// Name value pairs of the attributes or the text of a CHARACTERS event
+    std::vector<std::string> _data;
+};
+
+void exp_readerStartElement(void *data, const char *qName, const char **atts);
+void exp_readerEndElement(void *data, const char *qName);
+void exp_readerCharacterData(void *data, const char *s, int len);
+
+class XMLEventReaderImpl {
+  public:
+    XMLEventReaderImpl() : _parser(NULL), _attributes(new X3DXMLAttributes(NULL)), _started(false), _finished(false){};
+    ~XMLEventReaderImpl() {
+        close();
+        delete _attributes;
+    }
+
+    bool open(const char *fileStr) {
+        close();
+        _file.open(fileStr, std::ios::in | std::ios::binary);
+        if (!_file.is_open())
+            return false;
+
+        _parser = XML_ParserCreate(NULL);
+        XML_SetUserData(_parser, this);
+        XML_SetElementHandler(_parser, exp_readerStartElement, exp_readerEndElement);
+        XML_SetCharacterDataHandler(_parser, exp_readerCharacterData);
+        return true;
+    }
+
+    void close() {
+        if (_parser) {
+            XML_ParserFree(_parser);
+            _parser = NULL;
+        }
+        if (_file.is_open())
+            _file.close();
+        _file.clear();
+        _events.clear();
+        _characters.clear();
+        _started = false;
+        _finished = false;
+    }
+
+    void startElement(const char *qName, const char **atts) {
+        flushCharacters();
+        ExpatEvent event;
+        event._type = X3DEventReader::START_ELEMENT;
+        event._name = qName;
+        while (*atts)
+            event._data.push_back(*atts++);
+        _events.push_back(event);
+        suspend();
+    }
+
+    void endElement(const char *qName) {
+        flushCharacters();
+        ExpatEvent event;
+        event._type = X3DEventReader::END_ELEMENT;
+        event._name = qName;
+        _events.push_back(event);
+        suspend();
+    }
+
+    void characterData(const char *s, int len) {
+        _characters.append(s, len);
+    }
+
+    /// Parses until an event is queued
+    void fillQueue() {
+        static const int BUFF_SIZE = 64 * 1024;
+
+        while (_events.empty()) {
+            XML_ParsingStatus status;
+            XML_GetParsingStatus(_parser, &status);
+
+            XML_Status result;
+            if (status.parsing == XML_SUSPENDED) {
+                result = XML_ResumeParser(_parser);
+            } else if (status.parsing == XML_FINISHED) {
+                ExpatEvent event;
+                event._type = X3DEventReader::END_DOCUMENT;
+                _events.push_back(event);
+                return;
+            } else {
+                char *buffer = (char *)XML_GetBuffer(_parser, BUFF_SIZE);
+                if (buffer == NULL)
+                    throw X3DParseException("Could not acquire expat buffer");
+                _file.read(buffer, BUFF_SIZE);
+                result = XML_ParseBuffer(_parser, static_cast<int>(_file.gcount()), _file.eof());
+            }
+
+            if (result == XML_STATUS_ERROR)
+                throw X3DParseException(XML_ErrorString(XML_GetErrorCode(_parser)),
+                                        static_cast<int>(XML_GetCurrentLineNumber(_parser)),
+                                        static_cast<int>(XML_GetCurrentColumnNumber(_parser)));
+        }
+    }
+
+    /// Makes the first queued event the current one
+    void takeEvent() {
+        _current = _events.front();
+        _events.pop_front();
+
+        if (_current._type == X3DEventReader::START_ELEMENT) {
+            _attributePointers.clear();
+            for (std::vector<std::string>::const_iterator I = _current._data.begin(); I != _current._data.end(); I++)
+                _attributePointers.push_back(I->c_str());
+            _attributePointers.push_back(NULL);
+            delete _attributes;
+            _attributes = new X3DXMLAttributes(&_attributePointers[0]);
+        }
+    }
+
+    XML_Parser _parser;
+    std::ifstream _file;
+    std::deque<ExpatEvent> _events;
+    ExpatEvent _current;
+    std::vector<const char *> _attributePointers;
+    X3DXMLAttributes *_attributes;
+    bool _started;
+    bool _finished;
+
+  private:
+    /// Queues the character data collected since the last element event
+    void flushCharacters() {
+        if (_characters.find_first_not_of(" \t\r\n") != std::string::npos) {
+            ExpatEvent event;
+            event._type = X3DEventReader::CHARACTERS;
+            event._data.push_back(_characters);
+            _events.push_back(event);
+        }
+        _characters.clear();
+    }
+
+    /// Returns from XML_ParseBuffer() after the current callback
+    void suspend() {
+        XML_ParsingStatus status;
+        XML_GetParsingStatus(_parser, &status);
+        if (status.parsing == XML_PARSING)
+            XML_StopParser(_parser, XML_TRUE);
+    }
+
+    std::string _characters;
+};
+
+void exp_readerStartElement(void *data, const char *qName, const char **atts) {
+    XMLEventReaderImpl *p = reinterpret_cast<XMLEventReaderImpl *>(data);
+    p->startElement(qName, atts);
+}
+
+void exp_readerEndElement(void *data, const char *qName) {
+    XMLEventReaderImpl *p = reinterpret_cast<XMLEventReaderImpl *>(data);
+    p->endElement(qName);
+}
+
+void exp_readerCharacterData(void *data, const char *s, int len) {
+    XMLEventReaderImpl *p = reinterpret_cast<XMLEventReaderImpl *>(data);
+    p->characterData(s, len);
+}
+
+
+X3DXMLEventReader::X3DXMLEventReader() {
+    _impl = new XMLEventReaderImpl();
+}
+
+X3DXMLEventReader::~X3DXMLEventReader() {
+    delete _impl;
+}
+
+bool X3DXMLEventReader::open(const char *fileStr) {
+    _eventType = START_DOCUMENT;
+    _elementID = -1;
+    return _impl->open(fileStr);
+}
+
+void X3DXMLEventReader::close() {
+    _impl->close();
+}
+
+bool X3DXMLEventReader::hasNext() const {
+    return _impl->_parser && !_impl->_finished;
+}
+
+X3DEventReader::EventType X3DXMLEventReader::next() {
+    if (!hasNext())
+        throw X3DParseException("No more events");
+
+    if (!_impl->_started) {
+        _impl->_started = true;
+        _eventType = START_DOCUMENT;
+        return _eventType;
+    }
+
+    _impl->fillQueue();
+    _impl->takeEvent();
+
+    _eventType = _impl->_current._type;
+    if (_eventType == START_ELEMENT || _eventType == END_ELEMENT)
+        _elementID = X3DTypes::getElementID(_impl->_current._name);
+    else if (_eventType == END_DOCUMENT)
+        _impl->_finished = true;
+    return _eventType;
+}
+
+const X3DAttributes &X3DXMLEventReader::getAttributes() const {
+    assert(_eventType == START_ELEMENT);
+    return *_impl->_attributes;
+}
+
+std::string X3DXMLEventReader::getCharacters() const {
+    assert(_eventType == CHARACTERS);
+    return _impl->_current._data.front();
+}
+
+}  // namespace XIOT
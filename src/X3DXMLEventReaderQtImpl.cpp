@@ -0,0 +1,199 @@
+#include <xiot/X3DParseException.h>
+#include <xiot/X3DTypes.h>
+#include <xiot/X3DXMLAttributes.h>
+#include <xiot/X3DXMLEventReader.h>
+
+#include <QFile>
+#include <qxml.h>
+
+#include <cassert>
+#include <deque>
+#include <string>
+
+namespace XIOT {
+
+struct QtEvent {
+    X3DEventReader::EventType _type;
+    std::string _name;
+    QXmlAttributes _attributes;
+    std::string _characters;
+};
+
+class XMLEventReaderImpl : public QXmlDefaultHandler {
+  public:
+    XMLEventReaderImpl() : _attributes(new X3DXMLAttributes(NULL)), _open(false), _started(false), _finished(false), _parsing(false), _more(false), _error("") {
+        _parser.setContentHandler(this);
+        _parser.setErrorHandler(this);
+    };
+    ~XMLEventReaderImpl() {
+        delete _attributes;
+    }
+
+    bool startElement(const QString &, const QString &, const QString &qName, const QXmlAttributes &atts) {
+        flushCharacters();
+        QtEvent event;
+        event._type = X3DEventReader::START_ELEMENT;
+        event._name = qName.toAscii().constData();
+        event._attributes = atts;
+        _events.push_back(event);
+        return true;
+    }
+
+    bool endElement(const QString &, const QString &, const QString &qName) {
+        flushCharacters();
+        QtEvent event;
+        event._type = X3DEventReader::END_ELEMENT;
+        event._name = qName.toAscii().constData();
+        _events.push_back(event);
+        return true;
+    }
+
+    bool characters(const QString &ch) {
+        _characters += ch;
+        return true;
+    }
+
+    bool fatalError(const QXmlParseException &exception) {
+        _error = X3DParseException(exception.message().toAscii().constData(), exception.lineNumber(), exception.columnNumber());
+        return false;
+    }
+
+    /// Feeds blocks of the file to the parser until an event is queued
+    void fillQueue() {
+        static const qint64 BUFF_SIZE = 64 * 1024;
+
+        while (_events.empty()) {
+            if (!_more) {
+                QtEvent event;
+                event._type = X3DEventReader::END_DOCUMENT;
+                _events.push_back(event);
+                return;
+            }
+
+            // An empty block tells the parser that the document is complete
+            QByteArray block = _file.read(BUFF_SIZE);
+            if (block.isEmpty())
+                _more = false;
+            _source.setData(block);
+
+            bool ok;
+            if (!_parsing) {
+                _parsing = true;
+                ok = _parser.parse(&_source, true);
+            } else
+                ok = _parser.parseContinue();
+            if (!ok)
+                throw _error;
+        }
+    }
+
+    /// Makes the first queued event the current one
+    void takeEvent() {
+        _current = _events.front();
+        _events.pop_front();
+
+        if (_current._type == X3DEventReader::START_ELEMENT) {
+            delete _attributes;
+            _attributes = new X3DXMLAttributes(&_current._attributes);
+        }
+    }
+
+    QXmlSimpleReader _parser;
+    QFile _file;
+    QXmlInputSource _source;
+    std::deque<QtEvent> _events;
+    QtEvent _current;
+    X3DXMLAttributes *_attributes;
+    bool _open;
+    bool _started;
+    bool _finished;
+    bool _parsing;
+    /// false, if the last block of the file has been fed
+    bool _more;
+    QString _characters;
+
+  private:
+    /// Queues the character data collected since the last element event
+    void flushCharacters() {
+        if (!_characters.trimmed().isEmpty()) {
+            QtEvent event;
+            event._type = X3DEventReader::CHARACTERS;
+            event._characters = _characters.toAscii().constData();
+            _events.push_back(event);
+        }
+        _characters.clear();
+    }
+
+    X3DParseException _error;
+};
+
+
+X3DXMLEventReader::X3DXMLEventReader() {
+    _impl = new XMLEventReaderImpl();
+}
+
+X3DXMLEventReader::~X3DXMLEventReader() {
+    close();
+    delete _impl;
+}
+
+bool X3DXMLEventReader::open(const char *fileStr) {
+    close();
+    _eventType = START_DOCUMENT;
+    _elementID = -1;
+
+    _impl->_file.setFileName(fileStr);
+    if (!_impl->_file.open(QIODevice::ReadOnly))
+        return false;
+    _impl->_open = true;
+    _impl->_more = true;
+    return true;
+}
+
+void X3DXMLEventReader::close() {
+    _impl->_file.close();
+    _impl->_events.clear();
+    _impl->_characters.clear();
+    _impl->_open = false;
+    _impl->_started = false;
+    _impl->_finished = false;
+    _impl->_parsing = false;
+    _impl->_more = false;
+}
+
+bool X3DXMLEventReader::hasNext() const {
+    return _impl->_open && !_impl->_finished;
+}
+
+X3DEventReader::EventType X3DXMLEventReader::next() {
+    if (!hasNext())
+        throw X3DParseException("No more events");
+
+    if (!_impl->_started) {
+        _impl->_started = true;
+        _eventType = START_DOCUMENT;
+        return _eventType;
+    }
+
+    _impl->fillQueue();
+    _impl->takeEvent();
+
+    _eventType = _impl->_current._type;
+    if (_eventType == START_ELEMENT || _eventType == END_ELEMENT)
+        _elementID = X3DTypes::getElementID(_impl->_current._name);
+    else if (_eventType == END_DOCUMENT)
+        _impl->_finished = true;
+    return _eventType;
+}
+
+const X3DAttributes &X3DXMLEventReader::getAttributes() const {
+    assert(_eventType == START_ELEMENT);
+    return *_impl->_attributes;
+}
+
+std::string X3DXMLEventReader::getCharacters() const {
+    assert(_eventType == CHARACTERS);
+    return _impl->_current._characters;
+}
+
+}  // namespace XIOT
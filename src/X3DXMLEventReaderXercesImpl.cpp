@@ -0,0 +1,230 @@
+#include <xiot/X3DParseException.h>
+#include <xiot/X3DTypes.h>
+#include <xiot/X3DXMLAttributes.h>
+#include <xiot/X3DXMLEventReader.h>
+
+#include <xercesc/framework/XMLPScanToken.hpp>
+#include <xercesc/sax2/DefaultHandler.hpp>
+#include <xercesc/sax2/SAX2XMLReader.hpp>
+#include <xercesc/sax2/XMLReaderFactory.hpp>
+#include <xercesc/util/PlatformUtils.hpp>
+#include <xercesc/util/XMLString.hpp>
+#include <xercesc/util/XMLUniDefs.hpp>
+
+#include <cassert>
+#include <deque>
+#include <iostream>
+#include <string>
+
+using namespace std;
+XERCES_CPP_NAMESPACE_USE
+
+namespace XIOT {
+
+struct XercesEvent {
+    X3DEventReader::EventType _type;
+    std::string _name;
+    /// Valid until the parser scans the next token
+    const XERCES_CPP_NAMESPACE_QUALIFIER Attributes *_attributes;
+    std::string _characters;
+};
+
+class XMLEventReaderImpl : public DefaultHandler {
+  public:
+    XMLEventReaderImpl() : _parser(NULL), _attributes(new X3DXMLAttributes(NULL)), _open(false), _started(false), _finished(false), _more(false){};
+    ~XMLEventReaderImpl() {
+        delete _attributes;
+    }
+
+    void startElement(const XMLCh *const, const XMLCh *const, const XMLCh *const qname, const XERCES_CPP_NAMESPACE_QUALIFIER Attributes &attrs) {
+        flushCharacters();
+        XercesEvent event;
+        event._type = X3DEventReader::START_ELEMENT;
+        event._name = transcode(qname);
+        event._attributes = &attrs;
+        _events.push_back(event);
+    }
+
+    void endElement(const XMLCh *const, const XMLCh *const, const XMLCh *const qname) {
+        flushCharacters();
+        XercesEvent event;
+        event._type = X3DEventReader::END_ELEMENT;
+        event._name = transcode(qname);
+        event._attributes = NULL;
+        _events.push_back(event);
+    }
+
+    void characters(const XMLCh *const chars, const XMLSize_t length) {
+        _characters.append(chars, length);
+    }
+
+    void fatalError(const XERCES_CPP_NAMESPACE_QUALIFIER SAXParseException &exception) {
+        throw X3DParseException(transcode(exception.getMessage()), static_cast<int>(exception.getLineNumber()), static_cast<int>(exception.getColumnNumber()));
+    }
+
+    /// Scans tokens until an event is queued
+    void fillQueue() {
+        while (_events.empty()) {
+            if (!_more) {
+                XercesEvent event;
+                event._type = X3DEventReader::END_DOCUMENT;
+                event._attributes = NULL;
+                _events.push_back(event);
+                return;
+            }
+            try {
+                _more = _parser->parseNext(_token);
+            } catch (const SAXException &e) {
+                throw X3DParseException(transcode(e.getMessage()));
+            } catch (const XMLException &e) {
+                throw X3DParseException(transcode(e.getMessage()));
+            }
+        }
+    }
+
+    /// Makes the first queued event the current one
+    void takeEvent() {
+        _current = _events.front();
+        _events.pop_front();
+
+        if (_current._type == X3DEventReader::START_ELEMENT) {
+            delete _attributes;
+            _attributes = new X3DXMLAttributes(_current._attributes);
+        }
+    }
+
+    SAX2XMLReader *_parser;
+    XMLPScanToken _token;
+    std::deque<XercesEvent> _events;
+    XercesEvent _current;
+    X3DXMLAttributes *_attributes;
+    bool _open;
+    bool _started;
+    bool _finished;
+    /// false, if the parser reached the end of the document
+    bool _more;
+
+  private:
+    /// Queues the character data collected since the last element event
+    void flushCharacters() {
+        if (!isWhiteSpace(_characters)) {
+            XercesEvent event;
+            event._type = X3DEventReader::CHARACTERS;
+            event._attributes = NULL;
+            event._characters = transcode(_characters.c_str());
+            _events.push_back(event);
+        }
+        _characters.clear();
+    }
+
+    /// True for empty text, too
+    static bool isWhiteSpace(const std::basic_string<XMLCh> &characters) {
+        for (size_t i = 0; i < characters.size(); i++) {
+            XMLCh c = characters[i];
+            if (c != chSpace && c != chHTab && c != chLF && c != chCR)
+                return false;
+        }
+        return true;
+    }
+
+    static std::string transcode(const XMLCh *const xmlString) {
+        char *s = XMLString::transcode(xmlString);
+        std::string result(s);
+        XMLString::release(&s);
+        return result;
+    }
+
+    std::basic_string<XMLCh> _characters;
+};
+
+
+X3DXMLEventReader::X3DXMLEventReader() {
+    _impl = new XMLEventReaderImpl();
+    try {
+        XMLPlatformUtils::Initialize();
+    } catch (const XMLException &toCatch) {
+        char *message = XMLString::transcode(toCatch.getMessage());
+        cerr << "XercesEventReader::Error during initialization: " << message << endl;
+        XMLString::release(&message);
+    }
+
+    _impl->_parser = XMLReaderFactory::createXMLReader();
+    _impl->_parser->setFeature(XMLUni::fgSAX2CoreNameSpaces, true);
+    _impl->_parser->setFeature(XMLUni::fgXercesSchemaFullChecking, false);
+    _impl->_parser->setFeature(XMLUni::fgSAX2CoreNameSpacePrefixes, false);
+    _impl->_parser->setFeature(XMLUni::fgXercesLoadExternalDTD, false);
+    _impl->_parser->setFeature(XMLUni::fgXercesSchema, false);
+    _impl->_parser->setFeature(XMLUni::fgSAX2CoreValidation, false);
+    _impl->_parser->setContentHandler(_impl);
+    _impl->_parser->setErrorHandler(_impl);
+}
+
+X3DXMLEventReader::~X3DXMLEventReader() {
+    close();
+    delete _impl->_parser;
+    delete _impl;
+    XMLPlatformUtils::Terminate();
+}
+
+bool X3DXMLEventReader::open(const char *fileStr) {
+    close();
+    _eventType = START_DOCUMENT;
+    _elementID = -1;
+
+    try {
+        _impl->_more = _impl->_parser->parseFirst(fileStr, _impl->_token);
+    } catch (...) {
+        _impl->_more = false;
+    }
+    if (!_impl->_more)
+        return false;
+    _impl->_open = true;
+    return true;
+}
+
+void X3DXMLEventReader::close() {
+    if (_impl->_open)
+        _impl->_parser->parseReset(_impl->_token);
+    _impl->_events.clear();
+    _impl->_open = false;
+    _impl->_started = false;
+    _impl->_finished = false;
+    _impl->_more = false;
+}
+
+bool X3DXMLEventReader::hasNext() const {
+    return _impl->_open && !_impl->_finished;
+}
+
+X3DEventReader::EventType X3DXMLEventReader::next() {
+    if (!hasNext())
+        throw X3DParseException("No more events");
+
+    if (!_impl->_started) {
+        _impl->_started = true;
+        _eventType = START_DOCUMENT;
+        return _eventType;
+    }
+
+    _impl->fillQueue();
+    _impl->takeEvent();
+
+    _eventType = _impl->_current._type;
+    if (_eventType == START_ELEMENT || _eventType == END_ELEMENT)
+        _elementID = X3DTypes::getElementID(_impl->_current._name);
+    else if (_eventType == END_DOCUMENT)
+        _impl->_finished = true;
+    return _eventType;
+}
+
+const X3DAttributes &X3DXMLEventReader::getAttributes() const {
+    assert(_eventType == START_ELEMENT);
+    return *_impl->_attributes;
+}
+
+std::string X3DXMLEventReader::getCharacters() const {
+    assert(_eventType == CHARACTERS);
+    return _impl->_current._characters;
+}
+
+}  // namespace XIOT
@@ -2,6 +2,7 @@
 #include <xiot/X3DParseException.h>
 #include <xiot/X3DSwitch.h>
 #include <xiot/X3DTypes.h>
+#include <xiot/X3DInterestMask.h>
 #include <xiot/X3DXMLAttributes.h>
 #include <xiot/X3DXMLLoader.h>
 
@@ -17,7 +18,7 @@ namespace XIOT {
 
 class X3DXMLContentHandler {
   public:
-    X3DXMLContentHandler(X3DNodeHandler *nodeHandler);
+    X3DXMLContentHandler(X3DNodeHandler *nodeHandler, const X3DInterestMask *mask);
     ~X3DXMLContentHandler();
 
     virtual void startElement(const char *qName, const char **atts);
@@ -26,13 +27,21 @@ class X3DXMLContentHandler {
     void startDocument();
     void endDocument();
 
+    bool isAborted() const { return _aborted; };
+    XML_Parser _parser;
+
     //void fatalError(const XERCES_CPP_NAMESPACE_QUALIFIER SAXParseException& exception);
     //void error(const XERCES_CPP_NAMESPACE_QUALIFIER SAXParseException& exception);
 
   private:
     X3DNodeHandler *_nodeHandler;
+    /// Nodes of interest, NULL for all
+    const X3DInterestMask *_mask;
     X3DSwitch _switch;
     int _skipCount;
+    bool _aborted;
+
+    void abort();
 };
 
 void exp_startElement(void *data, const char *qName, const char **atts) {
@@ -63,16 +72,15 @@ class XMLParserImpl {
         _handler = handler;
         if (oldHandler)
             delete oldHandler;
+        _handler->_parser = _parser;
         XML_SetUserData(_parser, reinterpret_cast<void *>(_handler));
     }
 
     XML_Parser _parser;
-
-  private:
     X3DXMLContentHandler *_handler;
 };
 
-X3DXMLContentHandler::X3DXMLContentHandler(X3DNodeHandler *nodeHandler) : _nodeHandler(nodeHandler), _skipCount(0) {
+X3DXMLContentHandler::X3DXMLContentHandler(X3DNodeHandler *nodeHandler, const X3DInterestMask *mask) : _parser(NULL), _nodeHandler(nodeHandler), _mask(mask), _skipCount(0), _aborted(false) {
     _switch.setNodeHandler(nodeHandler);
 }
 
@@ -84,24 +92,41 @@ void X3DXMLContentHandler::startDocument() {
 }
 
 void X3DXMLContentHandler::startElement(const char *qName, const char **atts) {
+    // Expat may report some more events after stopping
+    if (_aborted)
+        return;
     if (_skipCount != 0) {
         _skipCount++;
         return;
     }
     int id = X3DTypes::getElementID(qName);
+    if (_mask && !_mask->hasNode(id))
+        return;
     X3DXMLAttributes xmlAttributes(atts);
     int state = _switch.doStartElement(id, xmlAttributes);
     if (state == XIOT::SKIP_CHILDREN)
         _skipCount = 1;
+    else if (state == XIOT::ABORT)
+        abort();
 }
 
 void X3DXMLContentHandler::endElement(const char *nodeName) {
+    if (_aborted)
+        return;
     if (_skipCount != 0) {
         _skipCount--;
         return;
     }
     int id = X3DTypes::getElementID(nodeName);
-    _switch.doEndElement(id, nodeName);
+    if (_mask && !_mask->hasNode(id))
+        return;
+    if (_switch.doEndElement(id, nodeName) == XIOT::ABORT)
+        abort();
+}
+
+void X3DXMLContentHandler::abort() {
+    _aborted = true;
+    XML_StopParser(_parser, XML_FALSE);
 }
 
 void X3DXMLContentHandler::endDocument() {
@@ -122,7 +147,8 @@ bool X3DXMLLoader::load(const char *fileStr, bool) const {
     std::fstream fin;
 
     assert(_handler);
-    _impl->setHandler(new X3DXMLContentHandler(_handler));
+    _aborted = false;
+    _impl->setHandler(new X3DXMLContentHandler(_handler, _interestMask));
 
     fin.open(fileStr, std::ios::in);
 
@@ -141,6 +167,11 @@ bool X3DXMLLoader::load(const char *fileStr, bool) const {
 
         fin.read(buffer, BUFF_SIZE);
         if (!XML_ParseBuffer(_impl->_parser, static_cast<int>(fin.gcount()), fin.eof())) {
+            if (_impl->_handler->isAborted()) {
+                fin.close();
+                _aborted = true;
+                break;
+            }
             // error
             cerr << XML_ErrorString(XML_GetErrorCode(_impl->_parser)) << endl;
             return false;
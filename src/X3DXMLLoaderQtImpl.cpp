@@ -2,6 +2,7 @@
 #include <xiot/X3DParseException.h>
 #include <xiot/X3DSwitch.h>
 #include <xiot/X3DTypes.h>
+#include <xiot/X3DInterestMask.h>
 #include <xiot/X3DXMLAttributes.h>
 #include <xiot/X3DXMLLoader.h>
 
@@ -26,7 +27,7 @@ class XMLParserImpl {
 
 class X3DXMLContentHandler : public QXmlDefaultHandler {
   public:
-    X3DXMLContentHandler(X3DNodeHandler *nodeHandler);
+    X3DXMLContentHandler(X3DNodeHandler *nodeHandler, const X3DInterestMask *mask);
     ~X3DXMLContentHandler();
 
     bool startDocument();
@@ -36,13 +37,18 @@ class X3DXMLContentHandler : public QXmlDefaultHandler {
     bool fatalError(const QXmlParseException &exception);
     bool error(const QXmlParseException &exception);
 
+    bool isAborted() const { return _aborted; };
+
   private:
     X3DNodeHandler *_nodeHandler;
+    /// Nodes of interest, NULL for all
+    const X3DInterestMask *_mask;
     X3DSwitch _switch;
     int _skipCount;
+    bool _aborted;
 };
 
-X3DXMLContentHandler::X3DXMLContentHandler(X3DNodeHandler *nodeHandler) : _nodeHandler(nodeHandler), _skipCount(0) {
+X3DXMLContentHandler::X3DXMLContentHandler(X3DNodeHandler *nodeHandler, const X3DInterestMask *mask) : _nodeHandler(nodeHandler), _mask(mask), _skipCount(0), _aborted(false) {
     _switch.setNodeHandler(nodeHandler);
 }
 
@@ -61,11 +67,16 @@ bool X3DXMLContentHandler::startElement(const QString &namespaceURI, const QStri
     }
 
     int id = X3DTypes::getElementID(qName.toAscii().constData());
+    if (_mask && !_mask->hasNode(id))
+        return true;
     X3DXMLAttributes xmlAttributes(&atts);
     int state = _switch.doStartElement(id, xmlAttributes);
     if (state == XIOT::SKIP_CHILDREN)
         _skipCount = 1;
-    return true;
+    else if (state == XIOT::ABORT)
+        _aborted = true;
+    // Returning false stops the parser
+    return !_aborted;
 }
 
 bool X3DXMLContentHandler::endElement(const QString &namespaceURI, const QString &localName, const QString &qName) {
@@ -75,8 +86,11 @@ bool X3DXMLContentHandler::endElement(const QString &namespaceURI, const QString
     }
     std::string nodeName(qName.toAscii().constData());
     int id = X3DTypes::getElementID(nodeName);
-    _switch.doEndElement(id, nodeName.c_str());
-    return true;
+    if (_mask && !_mask->hasNode(id))
+        return true;
+    if (_switch.doEndElement(id, nodeName.c_str()) == XIOT::ABORT)
+        _aborted = true;
+    return !_aborted;
 }
 
 bool X3DXMLContentHandler::endDocument() {
@@ -89,6 +103,9 @@ bool X3DXMLContentHandler::error(const QXmlParseException &exception) {
 }
 
 bool X3DXMLContentHandler::fatalError(const QXmlParseException &exception) {
+    // The parser reports the stop after ABORT as an error
+    if (_aborted)
+        return false;
     throw new X3DParseException(exception.message().toAscii().constData(), exception.lineNumber(), exception.columnNumber());
 }
 
@@ -107,9 +124,9 @@ X3DXMLLoader::~X3DXMLLoader() {
 
 bool X3DXMLLoader::load(const char *fileStr, bool fileValidation) const {
     assert(_handler);
+    _aborted = false;
 
-
-    _impl->_handler = new X3DXMLContentHandler(_handler);
+    _impl->_handler = new X3DXMLContentHandler(_handler, _interestMask);
     _impl->_parser->setContentHandler(_impl->_handler);
     _impl->_parser->setErrorHandler(_impl->_handler);
     _impl->_parser->setDTDHandler(_impl->_handler);
@@ -119,6 +136,11 @@ bool X3DXMLLoader::load(const char *fileStr, bool fileValidation) const {
 
     try {
         _impl->_parser->parse(source);
+        if (_impl->_handler->isAborted()) {
+            xmlFile.close();
+            _aborted = true;
+            _handler->endDocument();
+        }
     } catch (...) {
         cerr << "X3DXMLLoader::load: internal error." << endl;
         return false;
@@ -2,9 +2,11 @@
 #include <xiot/X3DParseException.h>
 #include <xiot/X3DSwitch.h>
 #include <xiot/X3DTypes.h>
+#include <xiot/X3DInterestMask.h>
 #include <xiot/X3DXMLAttributes.h>
 #include <xiot/X3DXMLLoader.h>
 
+#include <xercesc/framework/XMLPScanToken.hpp>
 #include <xercesc/sax2/DefaultHandler.hpp>
 #include <xercesc/sax2/XMLReaderFactory.hpp>
 #include <xercesc/util/PlatformUtils.hpp>
@@ -30,7 +32,7 @@ class XMLParserImpl {
 
 class X3DXMLContentHandler : public DefaultHandler {
   public:
-    X3DXMLContentHandler(X3DNodeHandler *nodeHandler);
+    X3DXMLContentHandler(X3DNodeHandler *nodeHandler, const X3DInterestMask *mask);
     ~X3DXMLContentHandler();
 
     void startDocument();
@@ -40,13 +42,18 @@ class X3DXMLContentHandler : public DefaultHandler {
     void fatalError(const XERCES_CPP_NAMESPACE_QUALIFIER SAXParseException &exception);
     void error(const XERCES_CPP_NAMESPACE_QUALIFIER SAXParseException &exception);
 
+    bool isAborted() const { return _aborted; };
+
   private:
     X3DNodeHandler *_nodeHandler;
+    /// Nodes of interest, NULL for all
+    const X3DInterestMask *_mask;
     X3DSwitch _switch;
     int _skipCount;
+    bool _aborted;
 };
 
-X3DXMLContentHandler::X3DXMLContentHandler(X3DNodeHandler *nodeHandler) : _nodeHandler(nodeHandler), _skipCount(0) {
+X3DXMLContentHandler::X3DXMLContentHandler(X3DNodeHandler *nodeHandler, const X3DInterestMask *mask) : _nodeHandler(nodeHandler), _mask(mask), _skipCount(0), _aborted(false) {
     _switch.setNodeHandler(nodeHandler);
 }
 
@@ -58,32 +65,43 @@ void X3DXMLContentHandler::startDocument() {
 }
 
 void X3DXMLContentHandler::startElement(const XMLCh *const, const XMLCh *const, const XMLCh *const qname, const Attributes &attrs) {
+    // The scanner may report more events of the current token
+    if (_aborted)
+        return;
     if (_skipCount != 0) {
         _skipCount++;
         return;
     }
     char *nodeName = XMLString::transcode(qname);
     int id = X3DTypes::getElementID(nodeName);
+    XMLString::release(&nodeName);
+    if (_mask && !_mask->hasNode(id))
+        return;
     X3DXMLAttributes xmlAttributes(&attrs);
     int state = _switch.doStartElement(id, xmlAttributes);
     if (state == XIOT::SKIP_CHILDREN)
         _skipCount = 1;
-    XMLString::release(&nodeName);
+    else if (state == XIOT::ABORT)
+        _aborted = true;
 }
 
 void X3DXMLContentHandler::endElement(const XMLCh *const, const XMLCh *const, const XMLCh *const qname) {
+    if (_aborted)
+        return;
     if (_skipCount != 0) {
         _skipCount--;
         return;
     }
     char *nodeName = XMLString::transcode(qname);
     int id = X3DTypes::getElementID(nodeName);
-    _switch.doEndElement(id, nodeName);
+    if ((!_mask || _mask->hasNode(id)) && _switch.doEndElement(id, nodeName) == XIOT::ABORT)
+        _aborted = true;
     XMLString::release(&nodeName);
 }
 
 void X3DXMLContentHandler::endDocument() {
-    _nodeHandler->endDocument();
+    if (!_aborted)
+        _nodeHandler->endDocument();
 }
 
 void X3DXMLContentHandler::error(const SAXParseException &exception) {
@@ -122,9 +140,9 @@ X3DXMLLoader::~X3DXMLLoader() {
 
 bool X3DXMLLoader::load(const char *fileStr, bool fileValidation) const {
     assert(_handler);
+    _aborted = false;
 
-
-    _impl->_handler = new X3DXMLContentHandler(_handler);
+    _impl->_handler = new X3DXMLContentHandler(_handler, _interestMask);
     _impl->_parser->setContentHandler(_impl->_handler);
     _impl->_parser->setErrorHandler(_impl->_handler);
     _impl->_parser->setDTDHandler(_impl->_handler);
@@ -139,8 +157,17 @@ bool X3DXMLLoader::load(const char *fileStr, bool fileValidation) const {
         _impl->_parser->setFeature(XMLUni::fgSAX2CoreValidation, false);
     }
 
+    // Scan progressively to be able to stop after a callback returned ABORT
     try {
-        _impl->_parser->parse(fileStr);
+        XMLPScanToken token;
+        bool more = _impl->_parser->parseFirst(fileStr, token);
+        while (more && !_impl->_handler->isAborted())
+            more = _impl->_parser->parseNext(token);
+        if (_impl->_handler->isAborted()) {
+            _impl->_parser->parseReset(token);
+            _aborted = true;
+            _handler->endDocument();
+        }
     } catch (SAXException &e) {
         cerr << "X3DXMLLoader::load: internal error: " << e.getMessage() << endl;
         return false;
@@ -1,7 +1,11 @@
 #include <xiot/X3DTypes.h>
 
+#include <algorithm>
 #include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
 #include <string>
+#include <vector>
 
 #define _CRT_SECURE_NO_DEPRECATE  // disable MSVS warning concerning unsafe "fopen"
 
@@ -113,56 +117,123 @@ void generateLogNodeHandler() {
 }
 
 
-void generateMaps() {
-    FILE *f = fopen("X3DTypes.cpp.inc", "w");
-
-
-    // Generate elementFromIDMap
+void generateInterestMask() {
+    FILE *f = fopen("X3DInterestMask.h.inc", "w");
     for (int i = 0; i < ID::X3DELEMENT_COUNT; i++) {
         std::string elementStr = X3DTypes::getElementByID(i);
-
-        fprintf(f, "elementFromIDMap.insert(std::pair<int,std::string>(%d, \"%s\"));\n", i, elementStr.c_str());
+        fprintf(f, "    if (overrides(&H::start%s) || overrides(&H::end%s))\n", elementStr.c_str(), elementStr.c_str());
+        fprintf(f, "        mask.addNode(ID::%s);\n", elementStr.c_str());
     }
+    fclose(f);
+}
 
-    fprintf(f, "\n\n");
-
-    // Generate elementFromStringMap
-    for (int i = 0; i < ID::X3DELEMENT_COUNT; i++) {
-        std::string elementStr = X3DTypes::getElementByID(i);
-
-        fprintf(f, "elementFromStringMap.insert(std::pair<std::string,int>(\"%s\", %d));\n", elementStr.c_str(), i);
+// Must match hashName() in X3DTypes.cpp
+unsigned int hashName(unsigned int seed, const char *str, size_t length) {
+    unsigned int hash = 2166136261u ^ seed;
+    for (size_t i = 0; i < length; i++) {
+        hash ^= static_cast<unsigned char>(str[i]);
+        hash *= 16777619u;
     }
+    // Mix the high bits into the low bits used for the table index
+    hash ^= hash >> 15;
+    hash *= 0x2c1b3c6du;
+    hash ^= hash >> 12;
+    return hash;
+}
 
-    fprintf(f, "\n\n");
-
-    // Generate attributeFromIDMap
-    for (int i = 0; i < ID::X3DATTRIBUTE_COUNT; i++) {
-        std::string attributeStr = X3DTypes::getAttributeByID(i);
+bool compareBucketSize(const std::vector<int> &a, const std::vector<int> &b) {
+    return a.size() > b.size();
+}
 
-        fprintf(f, "attributeFromIDMap.insert(std::pair<int,std::string>(%d, \"%s\"));\n", i, attributeStr.c_str());
+/**
+ * Writes the names and a perfect hash of them (hash and displace): The
+ * first hash of a name selects a bucket, the displacement of the bucket
+ * is the seed of the second hash which selects the slot holding the id.
+ */
+void generateNameTable(FILE *f, const char *prefix, int count, const char *(*getName)(int)) {
+    unsigned int bucketCount = 1;
+    while (bucketCount * 2 < static_cast<unsigned int>(count))
+        bucketCount *= 2;
+    unsigned int slotCount = 1;
+    while (slotCount < static_cast<unsigned int>(count) * 2)
+        slotCount *= 2;
+
+    std::vector<std::vector<int> > buckets(bucketCount);
+    for (int i = 0; i < count; i++)
+        buckets[hashName(0, getName(i), strlen(getName(i))) & (bucketCount - 1)].push_back(i);
+
+    std::vector<unsigned int> order(bucketCount);
+    for (unsigned int b = 0; b < bucketCount; b++)
+        order[b] = b;
+    std::vector<unsigned int> displacements(bucketCount, 0);
+    std::vector<int> slots(slotCount, -1);
+
+    // Place the large buckets first
+    std::vector<std::vector<int> > sorted(buckets);
+    std::stable_sort(sorted.begin(), sorted.end(), compareBucketSize);
+    for (size_t b = 0; b < sorted.size() && !sorted[b].empty(); b++) {
+        const std::vector<int> &bucket = sorted[b];
+        unsigned int index = hashName(0, getName(bucket[0]), strlen(getName(bucket[0]))) & (bucketCount - 1);
+        bool isPlaced = false;
+        for (unsigned int d = 1; d < 65536 && !isPlaced; d++) {
+            std::vector<unsigned int> used;
+            for (size_t k = 0; k < bucket.size(); k++) {
+                unsigned int slot = hashName(d, getName(bucket[k]), strlen(getName(bucket[k]))) & (slotCount - 1);
+                if (slots[slot] != -1 || std::find(used.begin(), used.end(), slot) != used.end())
+                    break;
+                used.push_back(slot);
+            }
+            if (used.size() == bucket.size()) {
+                for (size_t k = 0; k < bucket.size(); k++)
+                    slots[used[k]] = bucket[k];
+                displacements[index] = d;
+                isPlaced = true;
+            }
+        }
+        // A displacement of 0 would send the names to wrong slots
+        if (!isPlaced) {
+            fprintf(stderr, "No displacement places the %s bucket %u:", prefix, index);
+            for (size_t k = 0; k < bucket.size(); k++)
+                fprintf(stderr, " %s", getName(bucket[k]));
+            fprintf(stderr, "\n");
+            exit(1);
+        }
     }
 
-    fprintf(f, "\n\n");
+    fprintf(f, "static const char *const %sNames[%d] = {\n", prefix, count);
+    for (int i = 0; i < count; i++)
+        fprintf(f, "    \"%s\",\n", getName(i));
+    fprintf(f, "};\n\n");
 
-    // Generate attributeFromStringMap
-    for (int i = 0; i < ID::X3DATTRIBUTE_COUNT; i++) {
-        std::string attributeStr = X3DTypes::getAttributeByID(i);
+    fprintf(f, "static const unsigned short %sDisplacements[%u] = {", prefix, bucketCount);
+    for (unsigned int b = 0; b < bucketCount; b++)
+        fprintf(f, "%s%u,", b % 16 ? " " : "\n    ", displacements[b]);
+    fprintf(f, "\n};\n\n");
 
-        fprintf(f, "attributeFromStringMap.insert(std::pair<std::string,int>(\"%s\", %d));\n", attributeStr.c_str(), i);
-    }
+    fprintf(f, "static const short %sSlots[%u] = {", prefix, slotCount);
+    for (unsigned int s = 0; s < slotCount; s++)
+        fprintf(f, "%s%d,", s % 16 ? " " : "\n    ", slots[s]);
+    fprintf(f, "\n};\n\n");
 
+    fprintf(f, "static const NameTable %sTable = {%sNames, %d, %sDisplacements, %uu, %sSlots, %uu};\n\n",
+            prefix, prefix, count, prefix, bucketCount - 1, prefix, slotCount - 1);
+}
+
+void generateMaps() {
+    FILE *f = fopen("X3DTypes.cpp.inc", "w");
+    generateNameTable(f, "element", ID::X3DELEMENT_COUNT, X3DTypes::getElementByID);
+    generateNameTable(f, "attribute", ID::X3DATTRIBUTE_COUNT, X3DTypes::getAttributeByID);
     fclose(f);
 }
 
 
 int main(int argc, char *argv[]) {
-    X3DTypes::initMaps();
-
     generateX3DSwitch();
     generateNodeHandler();
     generateDefaultNodeHandler();
     generateLogNodeHandler();
-    //generateMaps();
+    generateInterestMask();
+    generateMaps();
 
     return 0;
 }
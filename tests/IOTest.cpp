@@ -1,14 +1,27 @@
 #include "Argument_helper.h"
+#include "benchmarkUtil.h"
 #include <iostream>
 #include <string>
 #include <fstream>
+#include <sstream>
+#include <vector>
 #include <cassert>
+#include <cstring>
+#include <climits>
+#include <cmath>
+#include <algorithm>
 #include <xiot/X3DLoader.h>
 #include <xiot/X3DDefaultNodeHandler.h>
 #include <xiot/X3DAttributes.h>
 #include <xiot/X3DParseException.h>
+#include <xiot/X3DNodeDeduplicator.h>
 #include <xiot/X3DWriterFI.h>
 #include <xiot/X3DWriterXML.h>
+#include <xiot/FITypes.h>
+#include <xiot/FIEncodingAlgorithms.h>
+#include <xiot/X3DFICodecRegistry.h>
+#include <xiot/X3DFIEncodingAlgorithms.h>
+#include <xiot/X3DParserVocabulary.h>
 
 
 using namespace std;
@@ -109,8 +122,439 @@ public:
 
 
 
+// A retained view has to keep its octets when the input is overwritten
+void testRetain()
+{
+	FI::NonEmptyOctetString input(4, 'x');
+	FI::OctetString octets(input);
+	assert(octets.isView());
+	octets.retain();
+	input.assign(4, 0);
+	assert(!octets.isView());
+	assert(octets.size() == 4);
+	for (size_t i = 0; i < octets.size(); i++)
+		assert(octets[i] == 'x');
+	cout << "Retained octets are kept" << endl;
+}
+
+// Registering codecs must not move the codecs found before
+void testCodecRegistry()
+{
+	X3DFICodecRegistry &registry = X3DFICodecRegistry::getInstance();
+	const X3DFICodec *deltazlib = registry.findByID(DeltazlibIntArrayAlgorithm::ALGORITHM_ID);
+	assert(deltazlib);
+	X3DFICodec codec;
+	codec.algorithm = deltazlib->algorithm;
+	codec.decodeIntArray = deltazlib->decodeIntArray;
+	for (int id = 100; id < 140; id++)
+	{
+		codec.algorithmID = id;
+		assert(registry.registerCodec(codec));
+	}
+	assert(!registry.registerCodec(codec));
+	codec.algorithmID = 300;
+	assert(!registry.registerCodec(codec));
+	assert(registry.findByID(DeltazlibIntArrayAlgorithm::ALGORITHM_ID) == deltazlib);
+	assert(deltazlib->algorithmID == DeltazlibIntArrayAlgorithm::ALGORITHM_ID);
+
+	X3DParserVocabulary vocabulary;
+	assert(&vocabulary._deltazlibIntArrayAlgorithm == deltazlib->algorithm);
+	cout << "Registered codecs keep their address" << endl;
+}
+
+// A Shape with an IndexedFaceSet of 10 triangles, firstIndex changes the content
+void writeFaceSet(X3DWriter &w, const char *def, int firstIndex)
+{
+	vector<int> index;
+	vector<float> points;
+	for (int i = 0; i < 30; i++)
+	{
+		index.push_back(i == 0 ? firstIndex : i);
+		if (i % 3 == 2)
+			index.push_back(-1);
+		points.push_back(float(i));
+		points.push_back(1.0f);
+		points.push_back(2.0f);
+	}
+	w.startNode(ID::Shape);
+	w.startNode(ID::IndexedFaceSet);
+	if (def)
+		w.setSFString(ID::DEF, def);
+	w.setMFInt32(ID::coordIndex, index);
+	w.startNode(ID::Coordinate);
+	w.setMFVec3f(ID::point, points);
+	w.endNode();
+	w.endNode();
+	w.endNode();
+}
+
+size_t countOf(const string &s, const string &part)
+{
+	size_t count = 0;
+	for (size_t pos = s.find(part); pos != string::npos; pos = s.find(part, pos + 1))
+		count++;
+	return count;
+}
+
+// Writes the face sets with the DEF values and first indices as XML
+string writeDeduplicated(const char *const defs[], const int firstIndices[], int count)
+{
+	size_t minimumSize = 16;
+	X3DWriterXML w;
+	w.setProperty(Property::ArrayDeduplication, &minimumSize);
+	ostringstream os;
+	w.openStream(os);
+	w.startX3DDocument();
+	for (int i = 0; i < count; i++)
+		writeFaceSet(w, defs[i], firstIndices[i]);
+	w.endX3DDocument();
+	w.closeFile();
+	return os.str();
+}
+
+void testDeduplication()
+{
+	// Equal nodes: the second one is a USE of the first
+	const char *anonymous[] = { NULL, NULL };
+	const int equal[] = { 0, 0 };
+	string x3d = writeDeduplicated(anonymous, equal, 2);
+	assert(countOf(x3d, "<IndexedFaceSet DEF=") == 1);
+	assert(countOf(x3d, "<IndexedFaceSet USE=") == 1);
+
+	// A node with a DEF may be the target of a ROUTE, it is never replaced
+	const char *named[] = { NULL, "A", "B" };
+	const int same[] = { 0, 0, 0 };
+	x3d = writeDeduplicated(named, same, 3);
+	assert(countOf(x3d, "<IndexedFaceSet DEF=\"A\"") == 1);
+	assert(countOf(x3d, "<IndexedFaceSet DEF=\"B\"") == 1);
+	assert(countOf(x3d, "<IndexedFaceSet USE=") == 0);
+
+	// The same size but another content: both are written in full
+	const int different[] = { 0, 1 };
+	x3d = writeDeduplicated(anonymous, different, 2);
+	assert(countOf(x3d, "<IndexedFaceSet DEF=") == 2);
+	assert(countOf(x3d, "<IndexedFaceSet USE=") == 0);
+	assert(countOf(x3d, "<Coordinate USE=") == 1);
+
+	// Generated names skip the DEF values of the document
+	const char *taken[] = { "_xiot0", NULL, NULL };
+	const int other[] = { 1, 0, 0 };
+	x3d = writeDeduplicated(taken, other, 3);
+	assert(countOf(x3d, "DEF=\"_xiot0\"") == 1);
+	assert(countOf(x3d, "<IndexedFaceSet USE=") == 1);
+	cout << "Repeated nodes are written as USE" << endl;
+}
+
+// Decoding the octets has to throw
+bool rejects(const FI::IEncodingAlgorithm &algorithm, const FI::NonEmptyOctetString &octets)
+{
+	try {
+		algorithm.decodeToString(octets);
+	} catch (std::exception&) {
+		return true;
+	}
+	return false;
+}
+
+void testBlockzlib()
+{
+	// Blocks of 1024 values: empty, one value, one full block and a block and a half
+	ParallelCompression parallel;
+	parallel.blockSize = 4096;
+	const size_t sizes[] = { 0, 1, 1024, 1536 };
+	for (int s = 0; s < 4; s++)
+	{
+		vector<float> floats;
+		vector<int> ints;
+		for (size_t i = 0; i < sizes[s]; i++)
+		{
+			floats.push_back(float(i) * 0.5f - 3.0f);
+			ints.push_back(i % 5 == 4 ? -1 : int(i));
+		}
+		FI::NonEmptyOctetString floatOctets, intOctets;
+		BlockzlibArrayAlgorithm::encode(floats.empty() ? NULL : &floats.front(), floats.size(), floatOctets, parallel);
+		BlockzlibArrayAlgorithm::encode(ints.empty() ? NULL : &ints.front(), ints.size(), intOctets, parallel);
+		assert(BlockzlibArrayAlgorithm::getLength(floatOctets) == sizes[s]);
+		assert(BlockzlibArrayAlgorithm::isFloatArray(floatOctets));
+		assert(!BlockzlibArrayAlgorithm::isFloatArray(intOctets));
+
+		vector<float> decodedFloats;
+		vector<int> decodedInts;
+		BlockzlibArrayAlgorithm::decodeToFloatArray(floatOctets, decodedFloats, 0, static_cast<size_t>(-1), 2);
+		BlockzlibArrayAlgorithm::decodeToIntArray(intOctets, decodedInts, 0, static_cast<size_t>(-1), 2);
+		assert(decodedFloats == floats);
+		assert(decodedInts == ints);
+	}
+
+	// Ranges across the block boundary, at the end, and after the end
+	vector<float> floats;
+	vector<int> ints;
+	for (int i = 0; i < 1536; i++)
+	{
+		floats.push_back(float(i) * 0.25f);
+		ints.push_back(i % 4 == 3 ? -1 : i);
+	}
+	FI::NonEmptyOctetString floatOctets, intOctets;
+	BlockzlibArrayAlgorithm::encode(&floats.front(), floats.size(), floatOctets, parallel);
+	BlockzlibArrayAlgorithm::encode(&ints.front(), ints.size(), intOctets, parallel);
+	vector<float> decodedFloats;
+	vector<int> decodedInts;
+	BlockzlibArrayAlgorithm::decodeToFloatArray(floatOctets, decodedFloats, 1000, 100);
+	BlockzlibArrayAlgorithm::decodeToIntArray(intOctets, decodedInts, 1000, 100);
+	assert(decodedFloats == vector<float>(floats.begin() + 1000, floats.begin() + 1100));
+	assert(decodedInts == vector<int>(ints.begin() + 1000, ints.begin() + 1100));
+	BlockzlibArrayAlgorithm::decodeToIntArray(intOctets, decodedInts, 1500, 100);
+	assert(decodedInts == vector<int>(ints.begin() + 1500, ints.end()));
+	BlockzlibArrayAlgorithm::decodeToIntArray(intOctets, decodedInts, 2000, 100);
+	assert(decodedInts.empty());
+
+	// Floats are not decoded as ints, and the header has to fit the data
+	bool rejected = false;
+	try {
+		BlockzlibArrayAlgorithm::decodeToIntArray(floatOctets, decodedInts);
+	} catch (std::exception&) {
+		rejected = true;
+	}
+	assert(rejected);
+	BlockzlibArrayAlgorithm algorithm;
+	FI::NonEmptyOctetString corrupt(floatOctets);
+	corrupt[6] = corrupt[7] = corrupt[8] = corrupt[9] = 0;
+	assert(rejects(algorithm, corrupt));
+	corrupt = floatOctets;
+	corrupt[10] = 0xff;
+	assert(rejects(algorithm, corrupt));
+	corrupt.assign(floatOctets.begin(), floatOctets.begin() + 9);
+	assert(rejects(algorithm, corrupt));
+	cout << "BlockzlibArrayAlgorithm round trips" << endl;
+}
+
+void testShufflezlib()
+{
+	// MFVec3f: empty, one float, one point, and a size that is not a multiple of the stride
+	const size_t sizes[] = { 0, 1, 3, 3001 };
+	for (int s = 0; s < 4; s++)
+	{
+		vector<float> floats;
+		for (size_t i = 0; i < sizes[s]; i++)
+			floats.push_back(i % 3 == 1 ? -float(i) / 7.0f : float(i) * 0.01f);
+		FI::NonEmptyOctetString octets;
+		ShufflezlibFloatArrayAlgorithm::encode(floats.empty() ? NULL : &floats.front(), floats.size(), octets, 3);
+		assert(ShufflezlibFloatArrayAlgorithm::getLength(octets) == sizes[s]);
+
+		// Lossless, compare the bits
+		vector<float> decoded;
+		ShufflezlibFloatArrayAlgorithm::decodeToFloatArray(octets, decoded);
+		assert(decoded.size() == floats.size());
+		assert(floats.empty() || memcmp(&decoded.front(), &floats.front(), floats.size() * sizeof(float)) == 0);
+	}
+
+	// A stride of 0, a wrong number of floats or missing octets
+	vector<float> floats(10, 1.5f);
+	FI::NonEmptyOctetString octets;
+	ShufflezlibFloatArrayAlgorithm::encode(&floats.front(), floats.size(), octets, 3);
+	ShufflezlibFloatArrayAlgorithm algorithm;
+	FI::NonEmptyOctetString corrupt(octets);
+	corrupt[0] = 0;
+	assert(rejects(algorithm, corrupt));
+	corrupt = octets;
+	corrupt[4]++;
+	assert(rejects(algorithm, corrupt));
+	corrupt.assign(octets.begin(), octets.begin() + 4);
+	assert(rejects(algorithm, corrupt));
+	cout << "ShufflezlibFloatArrayAlgorithm round trips" << endl;
+}
+
+void testMeshIndex()
+{
+	vector<vector<int> > indices(4);
+	indices[1].push_back(0);
+	// 8 is the last vertex in the move-to-front list, 7 is not in it
+	for (int i = 0; i < 40; i++)
+		indices[2].push_back(i);
+	indices[2].push_back(8);
+	indices[2].push_back(7);
+	indices[2].push_back(-1);
+	indices[2].push_back(2);
+	indices[2].push_back(1000);
+	vector<float> points;
+	createMesh(101, points, indices[3]);
+	for (size_t s = 0; s < indices.size(); s++)
+	{
+		const vector<int> &index = indices[s];
+		FI::NonEmptyOctetString octets;
+		MeshIndexAlgorithm::encode(index.empty() ? NULL : &index.front(), index.size(), octets);
+		vector<int> decoded;
+		MeshIndexAlgorithm::decodeToIntArray(octets, decoded);
+		assert(decoded == index);
+	}
+
+	// A wrong number of values or explicit vertices, or missing octets
+	FI::NonEmptyOctetString octets;
+	MeshIndexAlgorithm::encode(&indices[2].front(), indices[2].size(), octets);
+	MeshIndexAlgorithm algorithm;
+	FI::NonEmptyOctetString corrupt(octets);
+	corrupt[3]++;
+	assert(rejects(algorithm, corrupt));
+	corrupt = octets;
+	corrupt[7] = 0;
+	assert(rejects(algorithm, corrupt));
+	corrupt.assign(octets.begin(), octets.begin() + 7);
+	assert(rejects(algorithm, corrupt));
+	cout << "MeshIndexAlgorithm round trips" << endl;
+}
+
+// Decoding the mesh coordinates has to throw
+bool rejectsMeshCoordinate(const FI::NonEmptyOctetString &octets, const vector<int> &index)
+{
+	try {
+		vector<float> decoded;
+		MeshCoordinateAlgorithm::decodeToFloatArray(octets, index, decoded);
+	} catch (std::exception&) {
+		return true;
+	}
+	return false;
+}
+
+void testMeshCoordinate()
+{
+	// No point, one unused point, one quad, and a grid with an unused last point
+	const unsigned int vertices[] = { 0, 1, 4, 101 };
+	const unsigned int bits[] = { 12, 12, 1, 30 };
+	for (int s = 0; s < 4; s++)
+	{
+		vector<float> points;
+		vector<int> index;
+		createMesh(vertices[s], points, index);
+		// The same quads as triangles
+		vector<int> triangles;
+		for (size_t i = 0; i + 4 < index.size(); i += 5)
+		{
+			int triangle[] = { index[i], index[i + 1], index[i + 2], index[i], index[i + 2], index[i + 3] };
+			triangles.insert(triangles.end(), triangle, triangle + 6);
+		}
+
+		float minimum[3] = { 0, 0, 0 }, maximum[3] = { 0, 0, 0 };
+		for (size_t i = 0; i < points.size(); i++)
+		{
+			minimum[i % 3] = i < 3 ? points[i] : min(minimum[i % 3], points[i]);
+			maximum[i % 3] = i < 3 ? points[i] : max(maximum[i % 3], points[i]);
+		}
+		float range = max(maximum[0] - minimum[0], max(maximum[1] - minimum[1], maximum[2] - minimum[2]));
+		// Half a step of the grid, and the rounding of the floats
+		double maxError = range / ((1 << bits[s]) - 1) * 0.5 + 1e-6;
+
+		for (unsigned int faceSize = 0; faceSize <= 3; faceSize += 3)
+		{
+			const vector<int> &faces = faceSize ? triangles : index;
+			FI::NonEmptyOctetString octets;
+			MeshCoordinateAlgorithm::encode(points.empty() ? NULL : &points.front(), points.size(), faces, faceSize, bits[s], octets);
+			assert(MeshCoordinateAlgorithm::getLength(octets) == points.size());
+			vector<float> decoded;
+			MeshCoordinateAlgorithm::decodeToFloatArray(octets, faces, decoded);
+			assert(decoded.size() == points.size());
+			for (size_t i = 0; i < points.size(); i++)
+				assert(fabs(decoded[i] - points[i]) <= maxError);
+		}
+	}
+
+	// Bits or face size out of range, a wrong number of points or missing octets
+	vector<float> points;
+	vector<int> index;
+	createMesh(16, points, index);
+	FI::NonEmptyOctetString octets;
+	MeshCoordinateAlgorithm::encode(&points.front(), points.size(), index, 0, 12, octets);
+	FI::NonEmptyOctetString corrupt(octets);
+	corrupt[1] = 0;
+	assert(rejectsMeshCoordinate(corrupt, index));
+	corrupt = octets;
+	corrupt[0] = 4;
+	assert(rejectsMeshCoordinate(corrupt, index));
+	corrupt = octets;
+	corrupt[5]++;
+	assert(rejectsMeshCoordinate(corrupt, index));
+	corrupt.assign(octets.begin(), octets.begin() + 21);
+	assert(rejectsMeshCoordinate(corrupt, index));
+	cout << "MeshCoordinateAlgorithm round trips" << endl;
+}
+
+void testVarintzlib()
+{
+	vector<vector<int> > arrays(4);
+	arrays[1].push_back(-7);
+	// Faces of 4 with differences of one to five varint octets, and an incomplete face
+	const int values[] = { 0, 1, 2, -1, 100, 20000, 3000000, -1, INT_MAX, INT_MIN, 5, -1, 6, 7 };
+	arrays[2].assign(values, values + sizeof(values) / sizeof(values[0]));
+	vector<float> points;
+	createMesh(1000, points, arrays[3]);
+	for (size_t s = 0; s < arrays.size(); s++)
+	{
+		const vector<int> &ints = arrays[s];
+		FI::NonEmptyOctetString octets;
+		VarintzlibIntArrayAlgorithm::encode(ints.empty() ? NULL : &ints.front(), ints.size(), octets);
+		vector<int> decoded;
+		VarintzlibIntArrayAlgorithm::decodeToIntArray(octets, decoded);
+		assert(decoded == ints);
+	}
+
+	// Less varint octets than values, a wrong number of values or missing octets
+	FI::NonEmptyOctetString octets;
+	VarintzlibIntArrayAlgorithm::encode(&arrays[2].front(), arrays[2].size(), octets);
+	VarintzlibIntArrayAlgorithm algorithm;
+	FI::NonEmptyOctetString corrupt(octets);
+	corrupt[7] = 1;
+	assert(rejects(algorithm, corrupt));
+	corrupt = octets;
+	corrupt[3]++;
+	assert(rejects(algorithm, corrupt));
+	corrupt.assign(octets.begin(), octets.begin() + 8);
+	assert(rejects(algorithm, corrupt));
+	cout << "VarintzlibIntArrayAlgorithm round trips" << endl;
+}
+
+void testBoolean()
+{
+	// The first octet holds 4 values, every further octet 8
+	const size_t sizes[] = { 1, 4, 12, 13, 100 };
+	for (int s = 0; s < 5; s++)
+	{
+		MFBool values;
+		for (size_t i = 0; i < sizes[s]; i++)
+			values.push_back(i % 3 == 0 || i == sizes[s] - 1);
+		FI::NonEmptyOctetString octets;
+		FI::BooleanEncodingAlgorithm::encode(values, octets);
+		assert(octets.size() == (sizes[s] + 4 + 7) / 8);
+		assert(FI::BooleanEncodingAlgorithm::getLength(octets) == sizes[s]);
+		MFBool decoded;
+		FI::BooleanEncodingAlgorithm::decodeToBoolArray(octets, decoded);
+		assert(decoded == values);
+	}
+
+	// No values are not encoded, an empty string or more unused bits than bits are rejected
+	FI::NonEmptyOctetString octets;
+	FI::BooleanEncodingAlgorithm::encode(MFBool(), octets);
+	assert(octets.empty());
+	FI::BooleanEncodingAlgorithm algorithm;
+	assert(rejects(algorithm, octets));
+	octets.push_back(0x50);
+	assert(rejects(algorithm, octets));
+	octets[0] = 0x80;
+	octets.push_back(0);
+	assert(rejects(algorithm, octets));
+	cout << "BooleanEncodingAlgorithm round trips" << endl;
+}
+
 int start()
 {
+	testRetain();
+	testCodecRegistry();
+	testDeduplication();
+	testBlockzlib();
+	testShufflezlib();
+	testMeshIndex();
+	testMeshCoordinate();
+	testVarintzlib();
+	testBoolean();
+
 	X3DWriter* writer[2];
 	writer[0] = new X3DWriterXML();
 	writer[1] = new X3DWriterFI();
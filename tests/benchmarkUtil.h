@@ -0,0 +1,62 @@
+#ifndef X3D_benchmarkUtil_H
+#define X3D_benchmarkUtil_H
+
+#include <cmath>
+#include <vector>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <sys/time.h>
+#endif
+
+/**
+ * Returns the wall clock in seconds.
+ *
+ * clock() sums the time of all threads and is too coarse for small
+ * arrays, so the benchmarks measure the wall clock.
+ */
+inline double now()
+{
+#ifdef _WIN32
+	LARGE_INTEGER frequency, counter;
+	QueryPerformanceFrequency(&frequency);
+	QueryPerformanceCounter(&counter);
+	return double(counter.QuadPart) / double(frequency.QuadPart);
+#else
+	timeval tv;
+	gettimeofday(&tv, NULL);
+	return tv.tv_sec + tv.tv_usec * 1e-6;
+#endif
+}
+
+/**
+ * Creates a wavy grid of quads, similar to the coordinates and indices
+ * of an IndexedFaceSet. 4 vertices give a single quad.
+ */
+inline void createMesh(unsigned int vertices, std::vector<float> &points, std::vector<int> &index)
+{
+	unsigned int width = (unsigned int)sqrt((double)vertices);
+	if (width < 2)
+		width = 2;
+	for (unsigned int i = 0; i < vertices; i++)
+	{
+		float x = float(i % width) * 0.01f;
+		float z = float(i / width) * 0.01f;
+		points.push_back(x);
+		points.push_back(sin(x * 3.0f) * cos(z * 2.0f));
+		points.push_back(z);
+	}
+	for (unsigned int i = 0; i + width + 1 < vertices; i++)
+	{
+		if (i % width == width - 1)
+			continue;
+		index.push_back(i);
+		index.push_back(i + 1);
+		index.push_back(i + width + 1);
+		index.push_back(i + width);
+		index.push_back(-1);
+	}
+}
+
+#endif
@@ -2,7 +2,9 @@
 #include <iostream>
 #include <string>
 #include <fstream>
+#include <vector>
 #include <xiot/X3DLoader.h>
+#include <xiot/X3DFILoader.h>
 #include <xiot/X3DAttributes.h>
 #include "X3DLogNodeHandler.h"
 
@@ -11,16 +13,47 @@ using namespace std;
 
 std::string input_filename;
 std::string output_filename;
+unsigned int chunk_size = 0;
+
+// Feeds the file to the X3DFILoader in chunks of the given size, as if received from a network
+bool loadChunked(XIOT::X3DFILoader &loader, const std::string &input_filename)
+{
+	std::ifstream fin(input_filename.c_str(), std::ios::in | std::ios::binary);
+	if (!fin.is_open())
+		return false;
+	std::vector<char> chunk(chunk_size);
+	do {
+		fin.read(&chunk[0], chunk.size());
+		if (!loader.loadChunk(&chunk[0], (size_t)fin.gcount(), !fin.good()))
+			return false;
+	} while (fin.good());
+	return true;
+}
 
 int start(const std::string &input_filename, const std::string &output_filename)
 {
-	XIOT::X3DLoader loader;
 	X3DTypes::initMaps();
 	X3DLogNodeHandler* handler = new X3DLogNodeHandler(input_filename);
-	loader.setNodeHandler(handler);
-  loader.load(input_filename.c_str());
+	bool loaded;
+	if (chunk_size)
+	{
+		XIOT::X3DFILoader loader;
+		loader.setNodeHandler(handler);
+		loaded = loadChunked(loader, input_filename);
+	}
+	else
+	{
+		XIOT::X3DLoader loader;
+		loader.setNodeHandler(handler);
+		loaded = loader.load(input_filename.c_str());
+	}
 	
 	delete handler;
+	if (!loaded)
+	{
+		cerr << "Could not load " << input_filename << endl;
+		return 1;
+	}
 	return 0;
 }
 
@@ -43,6 +76,7 @@ int main(int argc, char *argv[])
 
   ah.new_string("input_filename.vtk", "The name of the input file", input_filename);
   //ah.new_string("output_filename", "The name of the output file", output_filename);
+  ah.new_named_unsigned_int('c', "chunk-size", "bytes", "Feed x3db files to the incremental parser in chunks of this size", chunk_size);
   
   //ARGUMENT_HELPER_BASICS(ah);
   ah.set_description("An eventLog creation tool.");
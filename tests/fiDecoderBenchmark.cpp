@@ -0,0 +1,99 @@
+#include "Argument_helper.h"
+#include <iostream>
+#include <string>
+#include <fstream>
+#include <vector>
+#include <ctime>
+#include <cstdio>
+#include <xiot/FIContentHandler.h>
+#include <xiot/FIInputSource.h>
+#include <xiot/FISAXParser.h>
+#include <xiot/X3DParserVocabulary.h>
+
+
+using namespace std;
+
+string input_filename;
+unsigned int nr_iter;
+
+// Counts the events, nothing else. This way only the decoding itself is measured.
+class CountingContentHandler : public FI::DefaultContentHandler
+{
+public:
+	CountingContentHandler() : elements(0), attributes(0) {}
+
+	void startElement(const FI::ParserVocabulary *, const FI::Element &, const FI::Attributes &attr)
+	{
+		elements++;
+		attributes += attr.size();
+	}
+
+	size_t elements;
+	size_t attributes;
+};
+
+int start(const std::string &filename)
+{
+	std::ifstream fin(filename.c_str(), std::ios::in | std::ios::binary);
+	std::vector<char> data((std::istreambuf_iterator<char>(fin)), std::istreambuf_iterator<char>());
+	if (data.empty())
+	{
+		cerr << "Input file is empty: " << filename << endl;
+		return 1;
+	}
+
+	// Only parse() is measured. Creating the parser and the X3D vocabulary
+	// would dominate the result for small files.
+	CountingContentHandler handler;
+	clock_t total = 0;
+	try {
+		for (unsigned int i = 0; i < nr_iter; i++)
+		{
+			FI::MemoryInputSource source(&data[0], data.size());
+			FI::SAXParser parser;
+			parser.setInputSource(&source);
+			parser.setContentHandler(&handler);
+			// The parser takes ownership of the vocabulary it uses
+			FI::ParserVocabulary *vocabulary = new XIOT::X3DParserVocabulary();
+			parser.addExternalVocabularies(vocabulary->getExternalVocabularyURI(), vocabulary);
+
+			clock_t start = clock();
+			parser.parse();
+			total += clock() - start;
+		}
+	}
+	catch (std::exception& e)
+	{
+		cerr << endl << "Decoding failed: " << e.what() << endl;
+		return 1;
+	}
+
+	double seconds = double(total) / CLOCKS_PER_SEC / (double)nr_iter;
+	size_t elements = handler.elements / nr_iter;
+	size_t attributes = handler.attributes / nr_iter;
+	printf ("%s: %lu elements, %lu attributes\n", filename.c_str(), (unsigned long)elements, (unsigned long)attributes);
+	printf ("Decoding took an average of %f seconds (%.1f ns per element).\n", seconds, elements ? seconds * 1e9 / elements : 0.0);
+	return 0;
+}
+
+int main(int argc, char *argv[])
+{
+  dsr::Argument_helper ah;
+
+  nr_iter = 100;
+
+  ah.new_string("input_filename.x3db", "The name of the input file", input_filename);
+  ah.new_optional_unsigned_int("iterations", "Number of iterations", nr_iter);
+
+  ah.set_description("Measures the pure Fast Infoset decoding cost per element");
+  ah.set_author("Kristian Sons, kristian.sons@actor3d.com");
+  ah.set_version(0.9f);
+  ah.set_build_date(__DATE__);
+
+  ah.process(argc, argv);
+
+  if (nr_iter == 0)
+    nr_iter = 1;
+
+  return start(input_filename);
+}
@@ -0,0 +1,96 @@
+#include "Argument_helper.h"
+#include <iostream>
+#include <vector>
+#include <cstdio>
+#include <xiot/FITypes.h>
+#include <xiot/X3DFICompressionTools.h>
+#include <xiot/X3DFIEncodingAlgorithms.h>
+#include "benchmarkUtil.h"
+
+using namespace std;
+
+unsigned int nr_vertices;
+unsigned int nr_iter;
+unsigned int max_threads;
+unsigned int block_size;
+
+int start()
+{
+	vector<float> points;
+	vector<int> index;
+	createMesh(nr_vertices, points, index);
+	printf("%u vertices: %lu floats, %lu ints, block size %u\n", nr_vertices, (unsigned long)points.size(), (unsigned long)index.size(), block_size);
+
+	double single = 0;
+	XIOT::ParallelCompression parallel;
+	parallel.blockSize = block_size;
+	for (unsigned int threads = 1; threads <= max_threads; threads *= 2)
+	{
+		parallel.threads = threads;
+		FI::NonEmptyOctetString floatOctets, intOctets;
+		double total = 0;
+		try {
+			for (unsigned int i = 0; i < nr_iter; i++)
+			{
+				floatOctets.clear();
+				intOctets.clear();
+				double start = now();
+				XIOT::QuantizedzlibFloatArrayAlgorithm::encode(&points[0], points.size(), floatOctets, XIOT::FloatQuantization(), parallel);
+				XIOT::DeltazlibIntArrayAlgorithm::encode(&index[0], index.size(), intOctets, false, parallel);
+				total += now() - start;
+			}
+
+			// The result has to decode to the same arrays
+			vector<float> decodedPoints;
+			vector<int> decodedIndex;
+			XIOT::QuantizedzlibFloatArrayAlgorithm::decodeToFloatArray(floatOctets, decodedPoints);
+			XIOT::DeltazlibIntArrayAlgorithm::decodeToIntArray(intOctets, decodedIndex);
+			if (decodedPoints != points || decodedIndex != index)
+			{
+				cerr << "Decoded arrays differ with " << threads << " threads" << endl;
+				return 1;
+			}
+		}
+		catch (std::exception& e)
+		{
+			cerr << endl << "Encoding failed: " << e.what() << endl;
+			return 1;
+		}
+
+		double seconds = total / (double)nr_iter;
+		if (threads == 1)
+			single = seconds;
+		printf ("%2u threads: %f seconds, speedup %.2f, %lu octets\n", threads, seconds, seconds > 0 ? single / seconds : 0.0,
+			(unsigned long)(floatOctets.size() + intOctets.size()));
+	}
+	return 0;
+}
+
+int main(int argc, char *argv[])
+{
+  dsr::Argument_helper ah;
+
+  nr_vertices = 2000000;
+  nr_iter = 5;
+  max_threads = XIOT::FITools::getNumberOfProcessors();
+  block_size = 131072;
+
+  ah.new_optional_unsigned_int("vertices", "Number of vertices of the mesh", nr_vertices);
+  ah.new_optional_unsigned_int("iterations", "Number of iterations", nr_iter);
+  ah.new_named_unsigned_int('t', "threads", "number", "Maximum number of threads", max_threads);
+  ah.new_named_unsigned_int('b', "block_size", "octets", "Size of the compressed blocks", block_size);
+
+  ah.set_description("Measures the scaling of the parallel array compression from 1 to N threads");
+  ah.set_author("Kristian Sons, kristian.sons@actor3d.com");
+  ah.set_version(0.9f);
+  ah.set_build_date(__DATE__);
+
+  ah.process(argc, argv);
+
+  if (nr_iter == 0)
+    nr_iter = 1;
+  if (max_threads == 0)
+    max_threads = 1;
+
+  return start();
+}
@@ -0,0 +1,115 @@
+#include "Argument_helper.h"
+#include <iostream>
+#include <string>
+#include <vector>
+#include <cstdio>
+#include <xiot/X3DNodeDeduplicator.h>
+#include <xiot/X3DTypes.h>
+#include <xiot/X3DWriterFI.h>
+#include "benchmarkUtil.h"
+
+using namespace std;
+
+string output_filename;
+unsigned int nr_nodes;
+unsigned int nr_iter;
+bool binary_single_fields;
+unsigned int deduplication;
+
+// Many small nodes with single value fields and short arrays, so the time
+// is spent in the bit level encoding rather than in compressing arrays
+void writeScene(XIOT::X3DWriter &writer, const vector<float> &points, const vector<int> &index)
+{
+	writer.startX3DDocument();
+	for (unsigned int i = 0; i < nr_nodes; i++)
+	{
+		writer.startNode(XIOT::ID::Transform);
+		writer.setSFVec3f(XIOT::ID::translation, float(i), 0.0f, 1.0f);
+		writer.setSFRotation(XIOT::ID::rotation, 0.0f, 1.0f, 0.0f, i * 0.01f);
+		writer.startNode(XIOT::ID::Shape);
+		writer.startNode(XIOT::ID::Appearance);
+		writer.startNode(XIOT::ID::Material);
+		writer.setSFColor(XIOT::ID::diffuseColor, 0.8f, 0.2f, 0.1f);
+		writer.setSFFloat(XIOT::ID::transparency, 0.5f);
+		writer.endNode();
+		writer.endNode();
+		writer.startNode(XIOT::ID::IndexedFaceSet);
+		writer.setSFBool(XIOT::ID::solid, (i & 1) != 0);
+		writer.setMFInt32(XIOT::ID::coordIndex, index);
+		writer.startNode(XIOT::ID::Coordinate);
+		writer.setMFVec3f(XIOT::ID::point, points);
+		writer.endNode();
+		writer.endNode();
+		writer.endNode();
+		writer.endNode();
+	}
+	writer.endX3DDocument();
+}
+
+int start()
+{
+	vector<float> points;
+	vector<int> index;
+	createMesh(4, points, index);
+
+	double total = 0;
+	size_t minimumSize = deduplication;
+	XIOT::DeduplicationStatistics statistics;
+	for (unsigned int i = 0; i < nr_iter; i++)
+	{
+		XIOT::X3DWriterFI writer;
+		writer.setProperty(XIOT::Property::BinarySingleFields, &binary_single_fields);
+		writer.setProperty(XIOT::Property::ArrayDeduplication, &minimumSize);
+		if (!writer.openFile(output_filename.c_str()))
+		{
+			cerr << "Could not open " << output_filename << endl;
+			return 1;
+		}
+		double start = now();
+		writeScene(writer, points, index);
+		writer.closeFile();
+		total += now() - start;
+		statistics = *static_cast<XIOT::DeduplicationStatistics *>(writer.getProperty(XIOT::Property::ArrayDeduplicationStatistics));
+	}
+
+	FILE *file = fopen(output_filename.c_str(), "rb");
+	if (!file)
+		return 1;
+	fseek(file, 0, SEEK_END);
+	long size = ftell(file);
+	fclose(file);
+
+	double seconds = total / (double)nr_iter;
+	printf("%u nodes: %ld octets, %f seconds, %.1f MB/s\n", nr_nodes, size, seconds, seconds > 0 ? size / seconds / 1e6 : 0.0);
+	if (deduplication)
+		printf("%lu nodes written as USE, %lu arrays and %lu octets not encoded\n", (unsigned long)statistics.nodes, (unsigned long)statistics.arrays, (unsigned long)statistics.octets);
+	return 0;
+}
+
+int main(int argc, char *argv[])
+{
+  dsr::Argument_helper ah;
+
+  nr_nodes = 200000;
+  nr_iter = 5;
+  binary_single_fields = false;
+  deduplication = 0;
+
+  ah.new_string("output_filename", "The name of the written file", output_filename);
+  ah.new_optional_unsigned_int("nodes", "Number of Transform nodes", nr_nodes);
+  ah.new_optional_unsigned_int("iterations", "Number of iterations", nr_iter);
+  ah.new_flag('b', "binary", "Encode the single value fields with the built-in algorithms", binary_single_fields);
+  ah.new_named_unsigned_int('d', "deduplication", "octets", "Write repeated geometry with at least this many array octets as USE", deduplication);
+
+  ah.set_description("Measures the throughput of the X3DWriterFI for a scene of many small nodes");
+  ah.set_author("Kristian Sons, kristian.sons@actor3d.com");
+  ah.set_version(0.9f);
+  ah.set_build_date(__DATE__);
+
+  ah.process(argc, argv);
+
+  if (nr_iter == 0)
+    nr_iter = 1;
+
+  return start();
+}
@@ -0,0 +1,131 @@
+#include "Argument_helper.h"
+#include <iostream>
+#include <string>
+#include <vector>
+#include <cstdio>
+#include <xiot/FITypes.h>
+#include <xiot/X3DAttributes.h>
+#include <xiot/X3DDefaultNodeHandler.h>
+#include <xiot/X3DFIEncodingAlgorithms.h>
+#include <xiot/X3DLoader.h>
+#include "benchmarkUtil.h"
+
+using namespace std;
+
+string input_filename;
+unsigned int nr_iter;
+
+// Collects the index arrays of all nodes
+class IndexCollector : public XIOT::X3DDefaultNodeHandler
+{
+public:
+	virtual int startUnhandled(const char *, const XIOT::X3DAttributes &attr)
+	{
+		for (size_t i = 0; i < attr.getLength(); i++)
+		{
+			string name = attr.getAttributeName((int)i);
+			if (name != "coordIndex" && name != "colorIndex" && name != "normalIndex" && name != "texCoordIndex" && name != "index")
+				continue;
+			XIOT::MFInt32 values;
+			attr.getMFInt32((int)i, values);
+			if (values.size() >= 15)
+				arrays.push_back(values);
+		}
+		return XIOT::CONTINUE;
+	}
+
+	vector<XIOT::MFInt32> arrays;
+};
+
+template <class Algorithm>
+bool measure(const char *name, const vector<XIOT::MFInt32> &arrays, const vector<FI::NonEmptyOctetString> &encoded, double encodeSeconds)
+{
+	size_t octets = 0;
+	vector<int> decoded;
+	double start = now();
+	for (unsigned int i = 0; i < nr_iter; i++)
+	{
+		for (size_t j = 0; j < encoded.size(); j++)
+			Algorithm::decodeToIntArray(FI::OctetString(encoded[j]), decoded);
+	}
+	double seconds = (now() - start) / (double)nr_iter;
+
+	for (size_t j = 0; j < encoded.size(); j++)
+	{
+		octets += encoded[j].size();
+		Algorithm::decodeToIntArray(FI::OctetString(encoded[j]), decoded);
+		if (decoded != arrays[j])
+		{
+			cerr << name << ": decoded array " << j << " differs" << endl;
+			return false;
+		}
+	}
+	printf("%-12s %10lu octets, encode %f seconds, decode %f seconds\n", name, (unsigned long)octets, encodeSeconds, seconds);
+	return true;
+}
+
+int start(const std::string &filename)
+{
+	IndexCollector collector;
+	XIOT::X3DLoader loader;
+	loader.setNodeHandler(&collector);
+	try {
+		loader.load(filename.c_str());
+	}
+	catch (std::exception& e)
+	{
+		cerr << endl << "Loading failed: " << e.what() << endl;
+		return 1;
+	}
+
+	size_t values = 0;
+	for (size_t j = 0; j < collector.arrays.size(); j++)
+		values += collector.arrays[j].size();
+	printf("%s: %lu index arrays, %lu ints (%lu octets)\n", filename.c_str(), (unsigned long)collector.arrays.size(), (unsigned long)values, (unsigned long)values * 4);
+	if (!values)
+		return 0;
+
+	vector<FI::NonEmptyOctetString> deltazlib(collector.arrays.size()), varintzlib(collector.arrays.size());
+	double start = now();
+	for (size_t j = 0; j < collector.arrays.size(); j++)
+		XIOT::DeltazlibIntArrayAlgorithm::encode(&collector.arrays[j][0], collector.arrays[j].size(), deltazlib[j]);
+	double deltazlibSeconds = now() - start;
+	start = now();
+	for (size_t j = 0; j < collector.arrays.size(); j++)
+		XIOT::VarintzlibIntArrayAlgorithm::encode(&collector.arrays[j][0], collector.arrays[j].size(), varintzlib[j]);
+	double varintzlibSeconds = now() - start;
+
+	try {
+		if (!measure<XIOT::DeltazlibIntArrayAlgorithm>("Deltazlib", collector.arrays, deltazlib, deltazlibSeconds) ||
+			!measure<XIOT::VarintzlibIntArrayAlgorithm>("Varintzlib", collector.arrays, varintzlib, varintzlibSeconds))
+			return 1;
+	}
+	catch (std::exception& e)
+	{
+		cerr << endl << "Decoding failed: " << e.what() << endl;
+		return 1;
+	}
+	return 0;
+}
+
+int main(int argc, char *argv[])
+{
+  dsr::Argument_helper ah;
+
+  nr_iter = 20;
+
+  ah.new_string("input_filename", "The name of the input file", input_filename);
+  ah.new_optional_unsigned_int("iterations", "Number of iterations", nr_iter);
+
+  ah.set_description("Compares the size and decoding time of the index arrays with the Deltazlib and Varintzlib algorithms");
+  ah.set_author("Kristian Sons, kristian.sons@actor3d.com");
+  ah.set_version(0.9f);
+  ah.set_build_date(__DATE__);
+
+  ah.process(argc, argv);
+
+  if (nr_iter == 0)
+    nr_iter = 1;
+
+  return start(input_filename);
+}
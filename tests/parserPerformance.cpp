@@ -3,7 +3,10 @@
 #include <string>
 #include <fstream>
 #include <ctime>
+#include <cstdlib>
+#include <new>
 #include <xiot/X3DDefaultNodeHandler.h>
+#include <xiot/X3DFILoader.h>
 #include <xiot/X3DLoader.h>
 #include <xiot/X3DTypes.h>
 #include <xiot/X3DAttributes.h>
@@ -13,9 +16,49 @@ using namespace std;
 using namespace XIOT;
 
 string input_filename;
-bool no_attributes, no_attribute_values;
+bool no_attributes, no_attribute_values, compare_input;
 unsigned int nr_iter;
 
+// Count heap allocations to monitor the allocation behaviour of the parser
+static size_t allocation_count = 0;
+
+void* operator new(size_t size)
+{
+  allocation_count++;
+  void *p = malloc(size ? size : 1);
+  if (!p)
+    throw std::bad_alloc();
+  return p;
+}
+
+void operator delete(void *p) throw()
+{
+  free(p);
+}
+
+void* operator new[](size_t size)
+{
+  return operator new(size);
+}
+
+void operator delete[](void *p) throw()
+{
+  free(p);
+}
+
+// The sized forms are called instead of the ones above since C++14
+#ifdef __cpp_sized_deallocation
+void operator delete(void *p, size_t) throw()
+{
+  free(p);
+}
+
+void operator delete[](void *p, size_t) throw()
+{
+  free(p);
+}
+#endif
+
 class MyContentHandler : public X3DDefaultNodeHandler
 {
 	void startDocument()
@@ -134,24 +177,58 @@ class MyContentHandler : public X3DDefaultNodeHandler
 };
 
 
-int start(const std::string &filename)
+double fileSize(const std::string &filename)
+{
+  std::ifstream fin(filename.c_str(), std::ios::in | std::ios::binary);
+  fin.seekg(0, std::ios::end);
+  return static_cast<double>(fin.tellg());
+}
+
+template<class Loader>
+double measure(Loader &l, const std::string &filename)
 {
-  X3DLoader l;
-  MyContentHandler handler;
-  l.setNodeHandler(&handler);
-	
-  
-	try {
   clock_t start,end;
+  size_t allocations = allocation_count;
   start = clock();
   for (unsigned int i = 0; i < nr_iter; i++)
     {
     l.load(filename.c_str());
     }
   end = clock();
-  double dif = double(end-start) / CLOCKS_PER_SEC;
-  printf ("Parsing took an average of %f seconds.\n", dif/(double)nr_iter);
+  printf ("Heap allocations per load: %lu\n", (unsigned long)((allocation_count - allocations) / nr_iter));
+  return double(end-start) / CLOCKS_PER_SEC / (double)nr_iter;
+}
+
+void report(const char *label, double seconds, double size)
+{
+  double throughput = seconds > 0 ? size / seconds / (1024.0 * 1024.0) : 0;
+  printf ("%sParsing took an average of %f seconds (%.2f MB/s).\n", label, seconds, throughput);
+}
 
+int start(const std::string &filename)
+{
+  MyContentHandler handler;
+  double size = fileSize(filename);
+	
+  
+	try {
+  if (compare_input && filename.find(".x3db") != std::string::npos)
+    {
+    X3DFILoader l;
+    l.setNodeHandler(&handler);
+    l.setMemoryMapping(true);
+    double mapped = measure(l, filename);
+    l.setMemoryMapping(false);
+    double buffered = measure(l, filename);
+    report("[memory mapped] ", mapped, size);
+    report("[buffered stream] ", buffered, size);
+    }
+  else
+    {
+    X3DLoader l;
+    l.setNodeHandler(&handler);
+    report("", measure(l, filename), size);
+    }
   }
   catch (std::exception& e)
 	{
@@ -182,6 +259,7 @@ int main(int argc, char *argv[])
   ah.new_string("input_filename", "The name of the input file", input_filename);
   ah.new_flag('a', "skip-attributes", "Do not process attributes", no_attributes);
   ah.new_flag('b', "skip-attributes-values", "Do not process attribute values", no_attribute_values);
+  ah.new_flag('c', "compare-input", "Compare memory mapped and buffered stream input (x3db only)", compare_input);
   ah.new_optional_unsigned_int("iterations", "Number of iterations", nr_iter);
 
   //ARGUMENT_HELPER_BASICS(ah);
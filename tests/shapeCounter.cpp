@@ -4,6 +4,8 @@
 #include <fstream>
 #include <xiot/X3DLoader.h>
 #include <xiot/X3DDefaultNodeHandler.h>
+#include <xiot/X3DEventReader.h>
+#include <xiot/X3DTypes.h>
 #include <xiot/X3DAttributes.h>
 #include <xiot/X3DParseException.h>
 
@@ -12,6 +14,7 @@ using namespace std;
 
 string input_filename;
 string output_filename;
+bool pull = false;
 
 class MyShapeCounter : public XIOT::X3DDefaultNodeHandler {
 	
@@ -37,8 +40,39 @@ class MyShapeCounter : public XIOT::X3DDefaultNodeHandler {
     int _count;  
 };
 
+int startPull(const string &input_filename)
+{
+	XIOT::X3DEventReader* reader = XIOT::X3DEventReader::create(input_filename.c_str());
+	if (!reader)
+	{
+	  cerr << "Could not open file " << input_filename << endl;
+	  return 1;
+	}
+	int count = 0;
+	try {
+	  while (reader->hasNext())
+	  {
+	    if (reader->next() == XIOT::X3DEventReader::START_ELEMENT && reader->getElementID() == XIOT::ID::Shape)
+	      count++;
+	  }
+	} catch (XIOT::X3DParseException& e)
+	{
+	  cerr << "Error while parsing file " << input_filename << ":" << endl;
+	  cerr << e.getMessage() << " (Line: " << e.getLineNumber() << ", Column: " << e.getColumnNumber() << ")" << endl;
+	  delete reader;
+	  return 1;
+	}
+	delete reader;
+	std::cout << "Found " << count << " shape nodes in file";
+	std::cout << std::endl;
+	return 0;
+}
+
 int start(const string &input_filename, const string &output_filename)
 {
+	if (pull)
+	  return startPull(input_filename);
+
 	XIOT::X3DLoader loader;
 	MyShapeCounter* handler = new MyShapeCounter();
 	loader.setNodeHandler(handler);
@@ -73,6 +107,7 @@ int main(int argc, char *argv[])
 
   ah.new_string("input_filename.x3d", "The name of the input file", input_filename);
   //ah.new_string("output_filename", "The name of the output file", output_filename);
+  ah.new_flag('p', "pull", "Count the shapes with the X3DEventReader", pull);
   
   //ARGUMENT_HELPER_BASICS(ah);
   ah.set_description("A simple test application for the X3DLoader");